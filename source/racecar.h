@@ -16,8 +16,8 @@ namespace Racecar
 {
 	typedef double Real;
 
-	static const Real kFixedTimeStep(0.01);
-	static const Real kEpsilon(0.00001);
+	static constexpr Real kFixedTimeStep(0.01);
+	static constexpr Real kEpsilon(0.00001);
 	extern Real kGravityConstant;
 
 	inline constexpr Real ComputeInertiaMetric(const Real& massInKilograms, const Real& radiusInMeters)
@@ -8,13 +8,29 @@
 
 #include "racecar_body.h"
 #include "racecar_wheel.h"
+#include "racecar_controller.h"
+
+#include <limits>
 
 //-------------------------------------------------------------------------------------------------------------------//
 
 Racecar::RacecarBody::RacecarBody(const Real& mass) :
 	mWheels{nullptr, nullptr, nullptr, nullptr},
+	mSuspension(),
+	mPlanarDynamics(),
+	mSurfaceMap(),
+	mSurfaceCursors(),
+	mWheelSurfaces{ SurfaceType::Tarmac, SurfaceType::Tarmac, SurfaceType::Tarmac, SurfaceType::Tarmac },
+	mTrackWidth(0.0),
+	mTrackProfile(),
 	mMass(mass),
-	mLinearVelocity(0.0)
+	mTotalMass(mass),
+	mLinearVelocity(0.0),
+	mPreviousLinearVelocity(0.0),
+	mLongitudinalAcceleration(0.0),
+	mControllerSubscription(kSteeringChannel),
+	mSteeringPosition(0.0),
+	mDistanceTravelled(0.0)
 {
 }
 
@@ -28,61 +44,350 @@ Racecar::RacecarBody::~RacecarBody(void)
 
 void Racecar::RacecarBody::ControllerChange(const Racecar::RacecarControllerInterface& racecarController)
 {
-	((void)racecarController);
+	if (true == mControllerSubscription.ConsumeChanges(racecarController))
+	{
+		mSteeringPosition = racecarController.GetSteeringPosition();
+	}
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
 
 void Racecar::RacecarBody::Simulate(const Real fixedTime)
 {
-	((void)fixedTime);
+	if (nullptr != mSurfaceMap)
+	{
+		SampleSurfaceMap();
+	}
+
+	if (nullptr != mTrackProfile)
+	{	//Down the slope  m * g * sin(angle)  where the grade is  tan(angle).
+		const Real grade(mTrackProfile->GetGrade(mDistanceTravelled));
+		ApplyLinearImpulse(-Racecar::GetGravityConstant() * mTotalMass * grade / sqrt(1.0 + grade * grade) * fixedTime);
+	}
+
+	//The brakes act after the slope so they can hold the racecar against it within the same step.
+	for (Wheel* wheel : mWheels)
+	{
+		if (nullptr != wheel)
+		{
+			wheel->ApplyBrakes(fixedTime);
+		}
+	}
+
+	if (nullptr != mSuspension)
+	{
+		mSuspension->Simulate(mLongitudinalAcceleration, mTotalMass, fixedTime);
+	}
+
+	SolveGroundContacts(fixedTime);
+
+	if (nullptr != mPlanarDynamics)
+	{
+		std::array<Real, 4> normalLoads;
+		std::array<Real, 4> gripLimits;
+		ComputeNormalLoads(normalLoads);
+		for (size_t wheelIndex(0); wheelIndex < mWheels.size(); ++wheelIndex)
+		{
+			gripLimits[wheelIndex] = (nullptr == mWheels[wheelIndex]) ? 0.0 : mWheels[wheelIndex]->GetGroundFrictionCoefficient();
+		}
+
+		mPlanarDynamics->Simulate(mLinearVelocity, mSteeringPosition, mTotalMass, normalLoads, gripLimits, fixedTime);
+	}
+
+	mDistanceTravelled += mLinearVelocity * fixedTime;
+	mLongitudinalAcceleration = (mLinearVelocity - mPreviousLinearVelocity) / fixedTime;
+	mPreviousLinearVelocity = mLinearVelocity;
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
 
-void Racecar::RacecarBody::SetLinearVelocity(const Real& linearVelocity)
+void Racecar::RacecarBody::SampleSurfaceMap(void)
 {
-	mLinearVelocity = linearVelocity;
-	for (Wheel* wheel : mWheels)
+	const Real heading((nullptr == mPlanarDynamics) ? 0.0 : mPlanarDynamics->GetHeading());
+	const Real positionX((nullptr == mPlanarDynamics) ? mDistanceTravelled : mPlanarDynamics->GetPositionX());
+	const Real positionY((nullptr == mPlanarDynamics) ? 0.0 : mPlanarDynamics->GetPositionY());
+	const Real cosine(cos(heading));
+	const Real sine(sin(heading));
+
+	//Each wheel sits ahead of the center of mass by its corner position and to the left by half the track width,
+	//  the even wheels on the left and the odd on the right, turned with the heading of the racecar.
+	for (size_t wheelIndex(0); wheelIndex < mWheels.size(); ++wheelIndex)
 	{
-		if (nullptr == wheel)
+		if (nullptr != mWheels[wheelIndex])
 		{
-			continue;
+			const Real cornerPosition((nullptr == mPlanarDynamics) ? 0.0 : mPlanarDynamics->GetCornerPosition(wheelIndex));
+			const Real lateralPosition(((0 == wheelIndex % 2) ? 0.5 : -0.5) * mTrackWidth);
+			const SurfaceCell& cell(mSurfaceMap->GetCell(positionX + cornerPosition * cosine - lateralPosition * sine,
+				positionY + cornerPosition * sine + lateralPosition * cosine, mSurfaceCursors[wheelIndex]));
+			mWheels[wheelIndex]->SetOnGround(mWheels[wheelIndex]->IsOnGround(), cell.GetFrictionCoefficient());
+			mWheelSurfaces[wheelIndex] = cell.GetSurfaceType();
 		}
-		
-		wheel->SetLinearVelocity(linearVelocity);
 	}
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
 
-Racecar::Real Racecar::RacecarBody::GetTotalMass(void) const
+void Racecar::RacecarBody::ComputeNormalLoads(std::array<Real, 4>& normalLoads) const
 {
-	Real totalMass(mMass);
+	size_t numberOfContacts(0);
+	for (const Wheel* wheel : mWheels)
+	{
+		if (nullptr != wheel && true == wheel->IsOnGround())
+		{
+			++numberOfContacts;
+		}
+	}
+
+	const Real sharedLoad((0 == numberOfContacts) ? 0.0 : Racecar::GetGravityConstant() * mTotalMass / numberOfContacts);
+	for (size_t wheelIndex(0); wheelIndex < mWheels.size(); ++wheelIndex)
+	{
+		const bool isOnGround(nullptr != mWheels[wheelIndex] && true == mWheels[wheelIndex]->IsOnGround());
+		normalLoads[wheelIndex] = (false == isOnGround) ? 0.0 :
+			(nullptr == mSuspension) ? sharedLoad : mSuspension->GetNormalLoad(wheelIndex);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::RacecarBody::SolveGroundContacts(const Real& fixedTime)
+{
+	std::array<Wheel*, 4> contactWheels;
+	std::array<Real, 4> contactLoads;
+	std::array<Real, 4> normalLoads;
+	size_t numberOfContacts(0);
+	ComputeNormalLoads(normalLoads);
+	for (size_t wheelIndex(0); wheelIndex < mWheels.size(); ++wheelIndex)
+	{
+		if (nullptr != mWheels[wheelIndex] && true == mWheels[wheelIndex]->IsOnGround())
+		{
+			contactLoads[numberOfContacts] = normalLoads[wheelIndex];
+			contactWheels[numberOfContacts++] = mWheels[wheelIndex];
+		}
+	}
+
+	if (0 == numberOfContacts)
+	{
+		return;
+	}
+
+	error_if(mTotalMass < 0.001, "Total Mass is too small.");
+	const Real inverseMass(1.0 / mTotalMass);
+
+	std::array<Real, 4> slipVelocities;   //meters / second
+	std::array<Real, 4> slipResponses;    //r^2 / I, the change in slip velocity from the wheel for each Newton-second.
+	std::array<Real, 4> impulseLimits;    //Newton-seconds
+	std::array<Real, 4> contactImpulses;  //Newton-seconds
+	std::array<bool, 4> isAtLimit;
+	for (size_t contactIndex(0); contactIndex < numberOfContacts; ++contactIndex)
+	{
+		const Wheel& wheel(*contactWheels[contactIndex]);
+		const Real radius(wheel.GetRadius());
+		slipVelocities[contactIndex] = wheel.GetAngularVelocity() * radius - mLinearVelocity;
+		slipResponses[contactIndex] = radius * radius / wheel.ComputeContactInertia();
+		isAtLimit[contactIndex] = false;
+	}
+
+	//When every contact rolls on the same tire, which is the usual racecar, the limits are found together by the tire.
+	const TireSpecification* sharedTire(contactWheels[0]->GetSpecification()->mTire.get());
+	for (size_t contactIndex(1); contactIndex < numberOfContacts; ++contactIndex)
+	{
+		if (contactWheels[contactIndex]->GetSpecification()->mTire.get() != sharedTire)
+		{
+			sharedTire = nullptr;
+		}
+	}
+
+	if (nullptr != sharedTire)
+	{
+		std::array<Real, 4> tireLoads;
+		std::array<Real, 4> inverseEffectiveMasses;
+		for (size_t contactIndex(0); contactIndex < numberOfContacts; ++contactIndex)
+		{
+			tireLoads[contactIndex] = contactWheels[contactIndex]->ComputeTireLoad(contactLoads[contactIndex]);
+			inverseEffectiveMasses[contactIndex] = slipResponses[contactIndex] + inverseMass;
+		}
+
+		sharedTire->ComputeContactImpulses(slipVelocities.data(), tireLoads.data(), inverseEffectiveMasses.data(),
+			impulseLimits.data(), numberOfContacts, mLinearVelocity, fixedTime);
+		for (size_t contactIndex(0); contactIndex < numberOfContacts; ++contactIndex)
+		{
+			impulseLimits[contactIndex] = fabs(impulseLimits[contactIndex]);
+		}
+	}
+	else
+	{
+		for (size_t contactIndex(0); contactIndex < numberOfContacts; ++contactIndex)
+		{
+			impulseLimits[contactIndex] = contactWheels[contactIndex]->ComputeContactImpulseLimit(
+				slipVelocities[contactIndex], contactLoads[contactIndex], slipResponses[contactIndex] + inverseMass, fixedTime);
+		}
+	}
+
+	for (size_t pass(0); pass < numberOfContacts; ++pass)
+	{
+		//With the impulse of the limited contacts known, the free contacts satisfy  d_i * J_i + S / m = b_i  where S is
+		//the sum of their impulses, so  S = sum(b_i / d_i) / (1 + sum(1 / d_i) / m)  and each J_i follows.
+		Real limitedImpulse(0.0);
+		Real weightedSlip(0.0);
+		Real inverseResponse(0.0);
+		for (size_t contactIndex(0); contactIndex < numberOfContacts; ++contactIndex)
+		{
+			if (true == isAtLimit[contactIndex])
+			{
+				limitedImpulse += contactImpulses[contactIndex];
+			}
+			else
+			{
+				weightedSlip += slipVelocities[contactIndex] / slipResponses[contactIndex];
+				inverseResponse += 1.0 / slipResponses[contactIndex];
+			}
+		}
+
+		weightedSlip -= limitedImpulse * inverseMass * inverseResponse;
+		const Real freeImpulse(weightedSlip / (1.0 + inverseResponse * inverseMass));
+		const Real bodySlip((freeImpulse + limitedImpulse) * inverseMass);
+
+		bool isSolved(true);
+		for (size_t contactIndex(0); contactIndex < numberOfContacts; ++contactIndex)
+		{
+			if (false == isAtLimit[contactIndex])
+			{
+				const Real impulse((slipVelocities[contactIndex] - bodySlip) / slipResponses[contactIndex]);
+				contactImpulses[contactIndex] = impulse;
+				if (fabs(impulse) > impulseLimits[contactIndex])
+				{
+					contactImpulses[contactIndex] = impulseLimits[contactIndex] * Racecar::Sign(impulse);
+					isAtLimit[contactIndex] = true;
+					isSolved = false;
+				}
+			}
+		}
+
+		if (true == isSolved)
+		{
+			break;
+		}
+	}
+
+	Real bodyImpulse(0.0);
+	for (size_t contactIndex(0); contactIndex < numberOfContacts; ++contactIndex)
+	{
+		if (fabs(contactImpulses[contactIndex]) > kEpsilon)
+		{	//Ensure there is some amount of frictional impulse, to avoid NaN.
+			contactWheels[contactIndex]->ApplyContactImpulse(contactImpulses[contactIndex]);
+			bodyImpulse += contactImpulses[contactIndex];
+		}
+	}
+
+	mLinearVelocity += bodyImpulse * inverseMass;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::RacecarBody::Reset(void)
+{
+	SetLinearVelocity(0.0);
+	mLongitudinalAcceleration = 0.0;
+	mDistanceTravelled = 0.0;
+	mSteeringPosition = 0.0;
+	mSurfaceCursors.fill(SurfaceMap::TileCursor());
+	mWheelSurfaces.fill(SurfaceType::Tarmac);
+
+	if (nullptr != mSuspension)
+	{
+		mSuspension->Reset();
+	}
+
+	if (nullptr != mPlanarDynamics)
+	{
+		mPlanarDynamics->Reset();
+	}
+
+	mControllerSubscription.Invalidate();
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::RacecarBody::SetLinearVelocity(const Real& linearVelocity)
+{
+	mLinearVelocity = linearVelocity;
+	mPreviousLinearVelocity = linearVelocity;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::RacecarBody::SetWheel(const size_t& wheelIndex, Wheel* wheelBody)
+{
+	mWheels[wheelIndex] = wheelBody;
+
+	mTotalMass = mMass;
 	for (Wheel* wheel : mWheels)
 	{
 		if (nullptr != wheel)
 		{
-			totalMass += wheel->GetMass();
+			mTotalMass += wheel->GetMass();
 		}
 	}
-	return totalMass;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::RacecarBody::SetSuspension(const std::shared_ptr<const SuspensionSpecification>& specification)
+{
+	mSuspension.reset((nullptr == specification) ? nullptr : new Suspension(specification));
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::RacecarBody::SetPlanarDynamics(const std::shared_ptr<const PlanarDynamicsSpecification>& specification)
+{
+	mPlanarDynamics.reset((nullptr == specification) ? nullptr : new PlanarDynamics(specification));
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::RacecarBody::SetTrackProfile(const std::shared_ptr<TrackProfile>& trackProfile)
+{
+	mTrackProfile = trackProfile;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::RacecarBody::SetDistanceTravelled(const Real& distance)
+{
+	mDistanceTravelled = distance;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::RacecarBody::SetSurfaceMap(const std::shared_ptr<const SurfaceMap>& surfaceMap)
+{
+	mSurfaceMap = surfaceMap;
+	mSurfaceCursors.fill(SurfaceMap::TileCursor());
+	mWheelSurfaces.fill(SurfaceType::Tarmac);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::RacecarBody::SetTrackWidth(const Real& trackWidth)
+{
+	error_if(trackWidth < 0.0, "Expected a track width that is not negative.");
+	mTrackWidth = trackWidth;
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
 
 void Racecar::RacecarBody::ApplyLinearImpulse(const Real& linearImpulse)
 {
-	const Real totalMass(GetTotalMass());
-	error_if(totalMass < 0.001, "Total Mass is too small.");
-	SetLinearVelocity(mLinearVelocity + linearImpulse / totalMass);
+	error_if(mTotalMass < 0.001, "Total Mass is too small.");
+	mLinearVelocity += linearImpulse / mTotalMass;
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
 
 void Racecar::RacecarBody::OnLinearVelocityChange(const Real& changeInLinearVelocity)
 {
-	SetLinearVelocity(mLinearVelocity + changeInLinearVelocity);
+	mLinearVelocity += changeInLinearVelocity;
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
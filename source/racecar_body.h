@@ -10,8 +10,14 @@
 #define _Racecar_Body_h_
 
 #include "racecar.h"
+#include "racecar_controller_channels.h"
+#include "racecar_suspension.h"
+#include "racecar_planar_dynamics.h"
+#include "racecar_surface_map.h"
+#include "racecar_track_profile.h"
 
 #include <array>
+#include <memory>
 
 namespace Racecar
 {
@@ -25,12 +31,30 @@ namespace Racecar
 		virtual ~RacecarBody(void);
 
 		///
-		///
+		/// @details Reads the steering position, only when it has changed since the last call.
 		///
 		void ControllerChange(const Racecar::RacecarControllerInterface& racecarController);
 
 		///
+		/// @details The next ControllerChange() reads the steering position again, even if it has not changed.
+		///
+		inline void ResetControllerChanges(void) { mControllerSubscription.Invalidate(); }
+
 		///
+		/// @details Returns the racecar to a standstill at the start of the track with the steering centered, the
+		///   suspension at rest and the planar dynamics at the origin. The wheels, suspension and planar dynamics
+		///   specifications, surface map and track profile are kept, and the next ControllerChange() reads the steering
+		///   position again.
+		///
+		void Reset(void);
+
+		///
+		/// @details Sets the ground friction of each wheel from the surface map beneath it, when the body has one,
+		///   pulls the racecar down the slope of the track profile, when the body has one, then applies the brakes of
+		///   each wheel so they hold against the slope. The suspension, when the body has one, is moved with the
+		///   acceleration of the previous step, then the ground contact of every wheel on the ground is solved
+		///   together, which should happen after each wheel has been simulated for the step. Finally the racecar is
+		///   moved in the plane, when the body has planar dynamics.
 		///
 		void Simulate(const Real fixedTime = Racecar::kFixedTimeStep);
 
@@ -46,22 +70,133 @@ namespace Racecar
 
 		inline const Real& GetLinearVelocity(void) const { return mLinearVelocity; }
 
+		///
+		/// @details Returns the change in linear velocity over the last step divided by the time step, in meters / second^2.
+		///
+		inline const Real& GetLongitudinalAcceleration(void) const { return mLongitudinalAcceleration; }
+
+		///
+		/// @details Returns the distance the racecar has driven forwards, less any driven backwards, in meters.
+		///
+		inline const Real& GetDistanceTravelled(void) const { return mDistanceTravelled; }
+
+		///
+		/// @details Places the racecar the distance along the track, in meters, without changing the velocity.
+		///
+		void SetDistanceTravelled(const Real& distance);
+
+		///
+		/// @details Sets the linear velocity without any acceleration, so the suspension does not see the jump in speed.
+		///
 		// This was at least needed for UnitTesting, may not be needed in API.
 		void SetLinearVelocity(const Real& linearVelocity);
 
 		inline const Real& GetMass(void) const { return mMass; }
-		Real GetTotalMass(void) const;
+
+		///
+		/// @details Returns the mass of the body and every wheel attached, which is kept as wheels are attached.
+		///
+		inline const Real& GetTotalMass(void) const { return mTotalMass; }
 
 		inline const Wheel* const GetWheel(const size_t& wheelIndex) const { return mWheels[wheelIndex]; }
 		inline Wheel* GetWheel(const size_t& wheelIndex) { return mWheels[wheelIndex]; }
-		inline void SetWheel(const size_t& wheelIndex, Wheel* wheelBody) { mWheels[wheelIndex] = wheelBody; }
+		void SetWheel(const size_t& wheelIndex, Wheel* wheelBody);
+
+		///
+		/// @details Attaches a suspension built from the specification, or removes it when nullptr. Without a suspension
+		///   the weight of the racecar is shared evenly by every wheel on the ground, with a suspension each wheel is
+		///   loaded by the corner of the same index.
+		///
+		void SetSuspension(const std::shared_ptr<const SuspensionSpecification>& specification);
+
+		///
+		/// @details Returns the suspension of the racecar, or nullptr when it has none.
+		///
+		inline const Suspension* GetSuspension(void) const { return mSuspension.get(); }
+
+		///
+		/// @details Adds the lateral motion and yaw of the racecar, steered by the controller, or removes it when nullptr.
+		///   Without planar dynamics the racecar only moves forwards and backwards, and the steering is ignored.
+		///
+		void SetPlanarDynamics(const std::shared_ptr<const PlanarDynamicsSpecification>& specification);
+
+		///
+		/// @details Returns the planar dynamics of the racecar, or nullptr when it has none.
+		///
+		inline const PlanarDynamics* GetPlanarDynamics(void) const { return mPlanarDynamics.get(); }
+		inline PlanarDynamics* GetPlanarDynamics(void) { return mPlanarDynamics.get(); }
+
+		///
+		/// @details Each step the wheels take the friction of the surface map beneath them, or keep the friction given
+		///   to Wheel::SetOnGround() when nullptr. The racecar is placed from the planar dynamics when the body has it,
+		///   otherwise it drives along the x axis of the map from the origin by the distance travelled, and each wheel
+		///   is placed out to the side by half the track width.
+		///
+		void SetSurfaceMap(const std::shared_ptr<const SurfaceMap>& surfaceMap);
+		inline const std::shared_ptr<const SurfaceMap>& GetSurfaceMap(void) const { return mSurfaceMap; }
+
+		///
+		/// @details Returns the surface beneath the wheel at the last step, which is Tarmac without a surface map.
+		///
+		inline SurfaceType GetWheelSurface(const size_t& wheelIndex) const { return mWheelSurfaces[wheelIndex]; }
+
+		///
+		/// @details The distance in meters between the left and right wheels, used to place each wheel on the surface
+		///   map. Wheels 0 and 2 are on the left and 1 and 3 on the right, which defaults to 0 for every wheel on the
+		///   center line of the racecar.
+		///
+		void SetTrackWidth(const Real& trackWidth);
+		inline const Real& GetTrackWidth(void) const { return mTrackWidth; }
+
+		///
+		/// @details Each step the component of gravity along the slope of the track, at the distance travelled, is
+		///   applied to the racecar as a linear impulse, or the track is flat when nullptr.
+		///
+		/// @note The track profile may be streamed from a file, so it should not be shared with racecars simulated
+		///   on other threads.
+		///
+		void SetTrackProfile(const std::shared_ptr<TrackProfile>& trackProfile);
+		inline const std::shared_ptr<TrackProfile>& GetTrackProfile(void) const { return mTrackProfile; }
 
 	protected:
 
 	private:
+		///
+		/// @details Computes the load of each wheel on the ground, from the suspension when the body has one, otherwise
+		///   the weight is shared evenly. A corner without a wheel on the ground has no load.
+		///
+		void ComputeNormalLoads(std::array<Real, 4>& normalLoads) const;
+
+		///
+		/// @details Sets the ground friction of each wheel from the cell of the surface map beneath it.
+		///
+		void SampleSurfaceMap(void);
+
+		///
+		/// @details Finds the impulse of each wheel contact so that every wheel and the body change speed together. The
+		///   contacts share the body, so the system is a diagonal plus the rank-one body term
+		///     (r^2 / I)_i * J_i + sum(J) / m = slip_i
+		///   which is solved directly in a single pass over the wheels. Any wheel that would need more impulse than its
+		///   friction allows is held at the limit and the rest solved again, once for each wheel at most.
+		///
+		void SolveGroundContacts(const Real& fixedTime);
+
 		std::array<Wheel*, 4> mWheels;
+		std::unique_ptr<Suspension> mSuspension;
+		std::unique_ptr<PlanarDynamics> mPlanarDynamics;
+		std::shared_ptr<const SurfaceMap> mSurfaceMap;
+		std::array<SurfaceMap::TileCursor, 4> mSurfaceCursors;
+		std::array<SurfaceType, 4> mWheelSurfaces;
+		Real mTrackWidth;
+		std::shared_ptr<TrackProfile> mTrackProfile;
 		Real mMass;
-		Real mLinearVelocity;
+		Real mTotalMass;
+		Real mLinearVelocity;        //Also the linear velocity of every attached wheel.
+		Real mPreviousLinearVelocity; //At the end of the last step.
+		Real mLongitudinalAcceleration;
+		ControllerSubscription mControllerSubscription;
+		Real mSteeringPosition;
+		Real mDistanceTravelled;
 	};
 };	/* namespace Racecar */
 
@@ -12,9 +12,8 @@
 
 //-------------------------------------------------------------------------------------------------------------------//
 
-Racecar::ClutchJoint::ClutchJoint(Real staticFrictionCoefficient, Real kineticFrictionCoefficient) :
-	mStaticFrictionCoefficient(staticFrictionCoefficient),
-	mKineticFrictionCoefficient(kineticFrictionCoefficient)
+Racecar::ClutchJoint::ClutchJoint(void) :
+	FrictionJoint()
 {
 }
 
@@ -26,25 +25,11 @@ Racecar::ClutchJoint::~ClutchJoint(void)
 
 //-------------------------------------------------------------------------------------------------------------------//
 
-Racecar::Real Racecar::ClutchJoint::ComputeTorqueImpulse(const RotatingBody& input, const RotatingBody& output, const Real& fixedTimeStep)
+Racecar::Real Racecar::ClutchJoint::ComputeTorqueImpulse(const RotatingBody& input, const RotatingBody& output,
+	const Real& staticFrictionCoefficient, const Real& kineticFrictionCoefficient, const Real& fixedTimeStep)
 {
-	const Real frictionImpulse(ComputeTorqueImpulseFromFriction(input, output, fixedTimeStep));
-	const Real matchingImpulse(ComputeTorqueImpulseToMatchVelocity(input, output));
-	if (fabs(matchingImpulse) > frictionImpulse)
-	{
-		return frictionImpulse * Racecar::Sign(matchingImpulse);
-	}
-
-	return matchingImpulse;
-}
-
-//-------------------------------------------------------------------------------------------------------------------//
-
-Racecar::Real Racecar::ClutchJoint::ComputeTorqueImpulseFromFriction(const RotatingBody& input, const RotatingBody& output, const Real& fixedTimeStep)
-{
-	const Real angularVelocityDifference(output.GetAngularVelocity() - input.GetAngularVelocity());
-	const Real& frictionCoefficient((fabs(angularVelocityDifference) > 0.1) ? mKineticFrictionCoefficient: mStaticFrictionCoefficient);
-	return mNormalForce * frictionCoefficient * fixedTimeStep;
+	return ComputeFrictionImpulse(ComputeTorqueImpulseToMatchVelocity(input, output), staticFrictionCoefficient,
+		kineticFrictionCoefficient, fixedTimeStep);
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
@@ -63,18 +48,37 @@ Racecar::Real Racecar::ClutchJoint::ComputeTorqueImpulseToMatchVelocity(const Ro
 //-------------------------------------------------------------------------------------------------------------------//
 //-------------------------------------------------------------------------------------------------------------------//
 
-Racecar::Clutch::Clutch(const Real& momentOfInertia, const Real& maximumNormalForce, 
+Racecar::ClutchSpecification::ClutchSpecification(const Real& momentOfInertia, const Real& maximumNormalForce,
 	const Real& staticFrictionCoefficient, const Real& kineticFrictionCoefficient) :
-	RotatingBody(momentOfInertia),
-	mClutchEngagement(1.0),
+	RotatingBodySpecification(momentOfInertia),
 	mMaximumNormalForce(maximumNormalForce),
-	mClutchJoint(staticFrictionCoefficient, kineticFrictionCoefficient)
+	mStaticFrictionCoefficient(staticFrictionCoefficient),
+	mKineticFrictionCoefficient(kineticFrictionCoefficient)
 {
 	error_if(mMaximumNormalForce <= 0.0, "Expected a positive normal force value.");
 	error_if(staticFrictionCoefficient <= 0.0, "Expected a positive staticFrictionCoefficient value.");
 	error_if(kineticFrictionCoefficient <= 0.0, "Expected a positive kineticFrictionCoefficient value.");
 }
 
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Clutch::Clutch(const Real& momentOfInertia, const Real& maximumNormalForce, 
+	const Real& staticFrictionCoefficient, const Real& kineticFrictionCoefficient) :
+	Clutch(std::make_shared<const ClutchSpecification>(momentOfInertia, maximumNormalForce, staticFrictionCoefficient, kineticFrictionCoefficient))
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Clutch::Clutch(const std::shared_ptr<const ClutchSpecification>& specification) :
+	RotatingBody(specification, kClutchChannel),
+	mClutchEngagement(1.0),
+	mClutchJoint()
+{
+}
+
 //-------------------------------------------------------------------------------------------------------------------//
 
 Racecar::Clutch::~Clutch(void)
@@ -95,17 +99,23 @@ void Racecar::Clutch::OnSimulate(const Real& fixedTime)
 	if (mClutchEngagement >= Racecar::PercentTo(0.5))
 	{
 		RotatingBody& inputSource(GetExpectedInputSource());
+		const ClutchSpecification& specification(GetSpecificationAs<ClutchSpecification>());
 
-		const Real actualNormalForce(mClutchEngagement * mMaximumNormalForce); //N //See above comment for where this comes from!
+		const Real actualNormalForce(mClutchEngagement * specification.mMaximumNormalForce); //N //See above comment for where this comes from!
 		mClutchJoint.SetNormalForce(actualNormalForce);
 
-		const Real frictionalImpulse = mClutchJoint.ComputeTorqueImpulse(inputSource, *this, fixedTime);
+		const Real frictionalImpulse = mClutchJoint.ComputeTorqueImpulse(inputSource, *this, specification.mStaticFrictionCoefficient,
+			specification.mKineticFrictionCoefficient, fixedTime);
 		if (fabs(frictionalImpulse) > kEpsilon)	//Make sure not zero!
 		{
 			inputSource.ApplyUpstreamAngularImpulse(frictionalImpulse);
 			ApplyDownstreamAngularImpulse(-frictionalImpulse);
 		}
 	}
+	else
+	{
+		mClutchJoint.Unlock();
+	}
 
 	RotatingBody::OnSimulate(fixedTime);
 }
@@ -129,6 +139,13 @@ Racecar::Real Racecar::Clutch::ComputeDownstreamInertia(void) const
 
 //-------------------------------------------------------------------------------------------------------------------//
 
+bool Racecar::Clutch::HasDownstreamLoad(void) const
+{
+	return (mClutchEngagement >= Racecar::PercentTo(0.5)) && RotatingBody::HasDownstreamLoad();
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
 Racecar::Real Racecar::Clutch::ComputeUpstreamInertia(void) const
 {
 	if (mClutchEngagement < Racecar::PercentTo(0.5))
@@ -11,30 +11,54 @@
 #define _Racecar_Clutch_h_
 
 #include "rotating_body.h"
+#include "racecar_friction_joint.h"
+
+#include <memory>
 
 namespace Racecar
 {
 	class RacecarControllerInterface;
 
-	class ClutchJoint
+	///
+	/// @details The frictional joint between the clutch disk and flywheel, see Racecar::FrictionJoint.
+	///
+	class ClutchJoint : public FrictionJoint
 	{
 	public:
-		ClutchJoint(Real staticFrictionCoefficient, Real kineticFrictionCoefficient);
+		ClutchJoint(void);
 		~ClutchJoint(void);
 
-		inline void SetNormalForce(const Real& normalForce) { mNormalForce = normalForce; }
-		Racecar::Real ComputeTorqueImpulse(const RotatingBody& input, const RotatingBody& output, const Real& fixedTimeStep = Racecar::kFixedTimeStep);
+		///
+		/// @details Computes the impulse the joint applies during the time step to bring the input and output together,
+		///   the joint locks once the speeds match and remains locked until the load overcomes static friction.
+		///
+		Racecar::Real ComputeTorqueImpulse(const RotatingBody& input, const RotatingBody& output, const Real& staticFrictionCoefficient,
+			const Real& kineticFrictionCoefficient, const Real& fixedTimeStep = Racecar::kFixedTimeStep);
 
 	private:
 		Racecar::Real ComputeTorqueImpulseToMatchVelocity(const RotatingBody& input, const RotatingBody& output);
-		Racecar::Real ComputeTorqueImpulseFromFriction(const RotatingBody& input, const RotatingBody& output, const Real& fixedTimeStep = Racecar::kFixedTimeStep);
-
-		const Real mStaticFrictionCoefficient;
-		const Real mKineticFrictionCoefficient;
-		Real mNormalForce; //N
 	};
 
 
+	///
+	/// @details The description of a Clutch that does not change while simulating, a single specification can be shared
+	///   by every clutch of the same model.
+	///
+	struct ClutchSpecification : public RotatingBodySpecification
+	{
+		///
+		/// @param staticFrictionCoefficient is default to 'steel-on-steel'
+		/// @param kineticFrictionCoefficient is default to 'steel-on-steel'
+		/// @ref http://www.school-for-champions.com/science/friction_equation.htm#.WBSr1fkrLZI
+		///
+		explicit ClutchSpecification(const Real& momentOfInertia, const Real& maximumNormalForce,
+			const Real& staticFrictionCoefficient = 0.6, const Real& kineticFrictionCoefficient = 0.4);
+
+		Real mMaximumNormalForce;         //N
+		Real mStaticFrictionCoefficient;
+		Real mKineticFrictionCoefficient;
+	};
+
 	class Clutch : public RotatingBody
 	{
 	public:
@@ -45,8 +69,18 @@ namespace Racecar
 		///
 		explicit Clutch(const Real& momentOfInertia, const Real& maximumNormalForce,
 			const Real& staticFrictionCoefficient = 0.6, const Real& kineticFrictionCoefficient = 0.4);
+
+		///
+		/// @details Creates a clutch that shares the specification with any other clutches created from it.
+		///
+		explicit Clutch(const std::shared_ptr<const ClutchSpecification>& specification);
 		virtual ~Clutch(void);
 
+		inline std::shared_ptr<const ClutchSpecification> GetSpecification(void) const
+		{
+			return GetSharedSpecificationAs<ClutchSpecification>();
+		}
+
 		///
 		///
 		///
@@ -54,6 +88,7 @@ namespace Racecar
 
 		virtual Real ComputeDownstreamInertia(void) const override;
 		virtual Real ComputeUpstreamInertia(void) const override;
+		virtual bool HasDownstreamLoad(void) const override;
 
 	protected:
 
@@ -76,7 +111,6 @@ namespace Racecar
 		//Real ComputeFrictionalTorque(void) const;
 
 		Real mClutchEngagement; //0.0f for disengaged, 1.0f for completely engaged.
-		const Real mMaximumNormalForce;
 		ClutchJoint mClutchJoint;
 	};
 };	/* namespace Racecar */
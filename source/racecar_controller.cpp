@@ -9,9 +9,14 @@
 
 #include "racecar_controller.h"
 
+#include <atomic>
+
 //--------------------------------------------------------------------------------------------------------------------//
 
 Racecar::RacecarControllerInterface::RacecarControllerInterface(void) :
+	mChannelChangeCounts(),
+	mChangeCount(1),
+	mIdentifier(CreateIdentifier()),
 	mThrottlePosition(0.0f),
 	mBrakePosition(0.0f),
 	mClutchPosition(0.0f),
@@ -19,22 +24,122 @@ Racecar::RacecarControllerInterface::RacecarControllerInterface(void) :
 	mShifterPosition(Gear::Neutral),
 	mIsUpshift(false),
 	mIsDownshift(false)
+{
+	//Every channel starts changed, so anything watching sees the starting positions.
+	mChannelChangeCounts.fill(mChangeCount);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Racecar::RacecarControllerInterface::RacecarControllerInterface(const RacecarControllerInterface& other) :
+	mChannelChangeCounts(other.mChannelChangeCounts),
+	mChangeCount(other.mChangeCount),
+	mIdentifier(CreateIdentifier()),
+	mThrottlePosition(other.mThrottlePosition),
+	mBrakePosition(other.mBrakePosition),
+	mClutchPosition(other.mClutchPosition),
+	mSteeringPosition(other.mSteeringPosition),
+	mShifterPosition(other.mShifterPosition),
+	mIsUpshift(other.mIsUpshift),
+	mIsDownshift(other.mIsDownshift)
 {
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+Racecar::RacecarControllerInterface& Racecar::RacecarControllerInterface::operator=(const RacecarControllerInterface& other)
+{	//Every control is taken from the other controller, anything watching this one must read them all again.
+	mChannelChangeCounts = other.mChannelChangeCounts;
+	mChangeCount = other.mChangeCount;
+	mIdentifier = CreateIdentifier();
+	mThrottlePosition = other.mThrottlePosition;
+	mBrakePosition = other.mBrakePosition;
+	mClutchPosition = other.mClutchPosition;
+	mSteeringPosition = other.mSteeringPosition;
+	mShifterPosition = other.mShifterPosition;
+	mIsUpshift = other.mIsUpshift;
+	mIsDownshift = other.mIsDownshift;
+	return *this;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 Racecar::RacecarControllerInterface::~RacecarControllerInterface(void)
 {
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+uint64_t Racecar::RacecarControllerInterface::CreateIdentifier(void)
+{
+	static std::atomic<uint64_t> nextIdentifier(1);
+	return nextIdentifier.fetch_add(1, std::memory_order_relaxed);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 void Racecar::RacecarControllerInterface::UpdateControls(void)
 {
 	OnUpdateControls();
 }
 
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::RacecarControllerInterface::MarkChanged(const ControllerChannels channel)
+{
+	++mChangeCount;
+	for (size_t channelIndex(0); channelIndex < kNumberOfControllerChannels; ++channelIndex)
+	{
+		if (channel == (1 << channelIndex))
+		{
+			mChannelChangeCounts[channelIndex] = mChangeCount;
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Racecar::ControllerChannels Racecar::RacecarControllerInterface::GetChangedChannels(const uint64_t sinceChangeCount) const
+{
+	ControllerChannels changedChannels(kNoControllerChannels);
+	for (size_t channelIndex(0); channelIndex < kNumberOfControllerChannels; ++channelIndex)
+	{
+		changedChannels |= (mChannelChangeCounts[channelIndex] > sinceChangeCount) ? ControllerChannels(1 << channelIndex) : kNoControllerChannels;
+	}
+
+	return changedChannels;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+Racecar::ControllerSubscription::ControllerSubscription(const ControllerChannels channels) :
+	mControllerIdentifier(0),
+	mChangeCount(0),
+	mChannels(channels)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::ControllerSubscription::SetChannels(const ControllerChannels channels)
+{
+	mChannels = channels;
+	Invalidate();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::ControllerSubscription::ConsumeChanges(const RacecarControllerInterface& racecarController)
+{
+	const bool hasChanged(racecarController.GetIdentifier() != mControllerIdentifier ||
+		kNoControllerChannels != (racecarController.GetChangedChannels(mChangeCount) & mChannels));
+	mControllerIdentifier = racecarController.GetIdentifier();
+	mChangeCount = racecarController.GetChangeCount();
+	return hasChanged;
+}
+
 //--------------------------------------------------------------------------------------------------------------------//
 //--------------------------------------------------------------------------------------------------------------------//
 //--------------------------------------------------------------------------------------------------------------------//
@@ -11,6 +11,9 @@
 #define _Racecar_RacecarController_h_
 
 #include "racecar_transmission.h" //For the Racecar::Gear definitions.
+#include "racecar_controller_channels.h"
+
+#include <array>
 
 namespace Racecar
 {
@@ -19,6 +22,8 @@ namespace Racecar
 	{
 	public:
 		RacecarControllerInterface(void);
+		RacecarControllerInterface(const RacecarControllerInterface& other);
+		RacecarControllerInterface& operator=(const RacecarControllerInterface& other);
 		virtual ~RacecarControllerInterface(void);
 
 		void UpdateControls(void);
@@ -34,18 +39,43 @@ namespace Racecar
 
 		inline Racecar::Gear GetShifterPosition(void) const { return mShifterPosition; }
 
+		///
+		/// @details Counts each time a control is set to a new value, setting a control to the value it already has is
+		///   not a change.
+		///
+		inline uint64_t GetChangeCount(void) const { return mChangeCount; }
+
+		///
+		/// @details A number unique to this controller, never reused by another controller even at the same address.
+		///   A copy of a controller is given its own identifier.
+		///
+		inline uint64_t GetIdentifier(void) const { return mIdentifier; }
+
+		///
+		/// @details Returns the channels that have changed after the change count given, see ControllerSubscription.
+		///
+		ControllerChannels GetChangedChannels(const uint64_t sinceChangeCount) const;
+
 	protected:
 		virtual void OnUpdateControls(void) = 0;
 
-		inline void SetThrottlePosition(const float throttle) { mThrottlePosition = ((throttle < 0.0f) ? 0.0f : (throttle > 1.0f) ? 1.0f : throttle); }
-		inline void SetBrakePosition(const float brake) { mBrakePosition = ((brake < 0.0f) ? 0.0f : (brake > 1.0f) ? 1.0f : brake); }
-		inline void SetClutchPosition(const float clutch) { mClutchPosition = ((clutch < 0.0f) ? 0.0f : (clutch > 1.0f) ? 1.0f : clutch); }
-		inline void SetSteeringPosition(const float steering) { mSteeringPosition = ((steering < -1.0f) ? -1.0f : (steering > 1.0f) ? 1.0f : steering); }
+		inline void SetThrottlePosition(const float throttle) { ChangePosition(mThrottlePosition, ((throttle < 0.0f) ? 0.0f : (throttle > 1.0f) ? 1.0f : throttle), kThrottleChannel); }
+		inline void SetBrakePosition(const float brake) { ChangePosition(mBrakePosition, ((brake < 0.0f) ? 0.0f : (brake > 1.0f) ? 1.0f : brake), kBrakeChannel); }
+		inline void SetClutchPosition(const float clutch) { ChangePosition(mClutchPosition, ((clutch < 0.0f) ? 0.0f : (clutch > 1.0f) ? 1.0f : clutch), kClutchChannel); }
+		inline void SetSteeringPosition(const float steering) { ChangePosition(mSteeringPosition, ((steering < -1.0f) ? -1.0f : (steering > 1.0f) ? 1.0f : steering), kSteeringChannel); }
 
-		inline void SetUpshift(const bool upshift) { mIsUpshift = upshift; }
-		inline void SetDownshift(const bool downshift) { mIsDownshift = downshift; }
-		inline void SetShifterPosition(const Gear& shifterPosition) { mShifterPosition = shifterPosition; }
+		inline void SetUpshift(const bool upshift) { if (upshift != mIsUpshift) { mIsUpshift = upshift; MarkChanged(kShiftButtonChannel); } }
+		inline void SetDownshift(const bool downshift) { if (downshift != mIsDownshift) { mIsDownshift = downshift; MarkChanged(kShiftButtonChannel); } }
+		inline void SetShifterPosition(const Gear& shifterPosition) { if (shifterPosition != mShifterPosition) { mShifterPosition = shifterPosition; MarkChanged(kShifterChannel); } }
 	private:
+		void MarkChanged(const ControllerChannels channel);
+		inline void ChangePosition(float& position, const float value, const ControllerChannels channel) { if (value != position) { position = value; MarkChanged(channel); } }
+
+		static uint64_t CreateIdentifier(void);
+
+		std::array<uint64_t, kNumberOfControllerChannels> mChannelChangeCounts;
+		uint64_t mChangeCount;
+		uint64_t mIdentifier;
 		float mThrottlePosition;
 		float mBrakePosition;
 		float mClutchPosition;
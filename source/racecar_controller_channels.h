@@ -0,0 +1,75 @@
+///
+/// @file
+/// @details Tracks which channels of a racecar controller changed, so each component only handles a controller
+///   change when an input it reads has changed.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#ifndef _Racecar_ControllerChannels_h_
+#define _Racecar_ControllerChannels_h_
+
+#include "racecar.h"
+
+#include <cstdint>
+
+namespace Racecar
+{
+
+	class RacecarControllerInterface;
+
+	///
+	/// @details A bitmask of the inputs of a controller, one bit for each channel.
+	///
+	typedef uint8_t ControllerChannels;
+
+	const ControllerChannels kNoControllerChannels = 0;
+	const ControllerChannels kThrottleChannel = 1 << 0;
+	const ControllerChannels kBrakeChannel = 1 << 1;
+	const ControllerChannels kClutchChannel = 1 << 2;
+	const ControllerChannels kSteeringChannel = 1 << 3;
+	const ControllerChannels kShifterChannel = 1 << 4;
+	const ControllerChannels kShiftButtonChannel = 1 << 5;  //Both the upshift and downshift buttons.
+	const ControllerChannels kAllControllerChannels = (1 << 6) - 1;
+	const size_t kNumberOfControllerChannels = 6;
+
+	///
+	/// @details Remembers the change count of the last controller seen so a component can ask whether any of the
+	///   channels it reads have changed since. A different controller than the last one, told apart by the identifier
+	///   of the controller rather than its address, always counts as changed, so any number of components can watch the
+	///   same controller without it ever clearing what has changed.
+	///
+	class ControllerSubscription
+	{
+	public:
+		explicit ControllerSubscription(const ControllerChannels channels = kAllControllerChannels);
+
+		inline ControllerChannels GetChannels(void) const { return mChannels; }
+
+		///
+		/// @details Changes the channels watched, the next call to ConsumeChanges() will report a change.
+		///
+		void SetChannels(const ControllerChannels channels);
+
+		///
+		/// @details Returns true when a watched channel of the controller changed since the last call, or when the
+		///   controller is not the one last seen, and remembers the controller as seen.
+		///
+		bool ConsumeChanges(const RacecarControllerInterface& racecarController);
+
+		///
+		/// @details Forgets the last controller seen, so the next call to ConsumeChanges() reports a change. Useful when
+		///   the values read from the controller were reset.
+		///
+		inline void Invalidate(void) { mControllerIdentifier = 0; }
+
+	private:
+		uint64_t mControllerIdentifier;  //0 for no controller, identifiers start from 1.
+		uint64_t mChangeCount;
+		ControllerChannels mChannels;
+	};
+
+};	/* namespace Racecar */
+
+#endif /* _Racecar_ControllerChannels_h_ */
@@ -0,0 +1,275 @@
+///
+/// @file
+/// @details Passes timestamped controller events from an input or network thread to the simulation thread, so each
+///   input is applied at the time step it happened within rather than whenever the simulation next reads it.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#include "racecar_controller_queue.h"
+
+namespace
+{
+	static_assert(static_cast<size_t>(Racecar::ControllerInput::Steering) == 3, "The analog axes must come first in Racecar::ControllerInput.");
+};
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::ControllerEvent::ControllerEvent(void) :
+	mTime(0.0),
+	mValue(0.0f),
+	mInput(ControllerInput::Throttle)
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::ControllerEvent::ControllerEvent(const Real& time, const ControllerInput input, const float value) :
+	mTime(time),
+	mValue(value),
+	mInput(input)
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::ControllerEvent::ControllerEvent(const Real& time, const Gear& shifterPosition) :
+	mTime(time),
+	mValue(static_cast<float>(static_cast<int>(shifterPosition))),
+	mInput(ControllerInput::Shifter)
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::ControllerEventQueue::ControllerEventQueue(const size_t capacity) :
+	mEvents(),
+	mMask(0),
+	mHead(0),
+	mTail(0)
+{
+	error_if(0 == capacity, "ControllerEventQueue expects room for at least one event.");
+
+	size_t roundedCapacity(1);
+	while (roundedCapacity < capacity)
+	{
+		roundedCapacity <<= 1;
+	}
+
+	mEvents.reset(new ControllerEvent[roundedCapacity]);
+	mMask = roundedCapacity - 1;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::ControllerEventQueue::~ControllerEventQueue(void)
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::ControllerEventQueue::Push(const ControllerEvent& controllerEvent)
+{
+	//The tail is only written by this thread, the head is acquired so the slot is not still being read.
+	const size_t tail(mTail.load(std::memory_order_relaxed));
+	if (tail - mHead.load(std::memory_order_acquire) > mMask)
+	{
+		return false;
+	}
+
+	mEvents[tail & mMask] = controllerEvent;
+	mTail.store(tail + 1, std::memory_order_release);
+	return true;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::ControllerEventQueue::Pop(ControllerEvent& controllerEvent)
+{
+	const size_t head(mHead.load(std::memory_order_relaxed));
+	if (head == mTail.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	controllerEvent = mEvents[head & mMask];
+	mHead.store(head + 1, std::memory_order_release);
+	return true;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::QueuedController::QueuedController(ControllerEventQueue& eventQueue, const bool isInterpolating) :
+	RacecarControllerInterface(),
+	mEventQueue(eventQueue),
+	mPreviousSamples(),
+	mNextSamples(),
+	mHasNextSample(),
+	mHeldEvent(),
+	mSimulationTime(0.0),
+	mStepEndTime(Racecar::kFixedTimeStep),
+	mHasHeldEvent(false),
+	mIsInterpolating(isInterpolating),
+	mIsUpshiftPressed(false),
+	mIsDownshiftPressed(false),
+	mIsUpshiftReleasePending(false),
+	mIsDownshiftReleasePending(false)
+{
+	mPreviousSamples.fill(AxisSample{ 0.0, 0.0f });
+	mNextSamples.fill(AxisSample{ 0.0, 0.0f });
+	mHasNextSample.fill(false);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::QueuedController::~QueuedController(void)
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::QueuedController::SetTimeStep(const Real& simulationTime, const Real& fixedTime)
+{
+	mSimulationTime = simulationTime;
+	mStepEndTime = simulationTime + fixedTime;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::QueuedController::OnUpdateControls(void)
+{
+	mIsUpshiftPressed = false;
+	mIsDownshiftPressed = false;
+	if (true == mIsUpshiftReleasePending)
+	{
+		SetUpshift(false);
+		mIsUpshiftReleasePending = false;
+	}
+
+	if (true == mIsDownshiftReleasePending)
+	{
+		SetDownshift(false);
+		mIsDownshiftReleasePending = false;
+	}
+
+	for (size_t axisIndex(0); axisIndex < kNumberOfAxes; ++axisIndex)
+	{
+		if (true == mHasNextSample[axisIndex] && mNextSamples[axisIndex].mTime <= mSimulationTime)
+		{
+			mPreviousSamples[axisIndex] = mNextSamples[axisIndex];
+			mHasNextSample[axisIndex] = false;
+		}
+	}
+
+	//Events are taken in order until one is beyond this step, an axis being interpolated looks past its next event to
+	//  events of the other inputs, anything else waits at the front as the held event.
+	while (true)
+	{
+		if (true == mHasHeldEvent)
+		{
+			if (false == IsDue(mHeldEvent))
+			{
+				break;
+			}
+
+			ApplyEvent(mHeldEvent);
+			mHasHeldEvent = false;
+		}
+
+		ControllerEvent controllerEvent;
+		if (false == mEventQueue.Pop(controllerEvent))
+		{
+			break;
+		}
+
+		const size_t axisIndex(static_cast<size_t>(controllerEvent.mInput));
+		if (controllerEvent.mTime > mSimulationTime && true == mIsInterpolating &&
+			axisIndex < kNumberOfAxes && false == mHasNextSample[axisIndex])
+		{
+			mNextSamples[axisIndex] = AxisSample{ controllerEvent.mTime, controllerEvent.mValue };
+			mHasNextSample[axisIndex] = true;
+			continue;
+		}
+
+		mHeldEvent = controllerEvent;
+		mHasHeldEvent = true;
+	}
+
+	for (size_t axisIndex(0); axisIndex < kNumberOfAxes; ++axisIndex)
+	{
+		const AxisSample& previous(mPreviousSamples[axisIndex]);
+		const AxisSample& next(mNextSamples[axisIndex]);
+		float position(previous.mValue);
+		if (true == mHasNextSample[axisIndex] && next.mTime > previous.mTime)
+		{
+			const Real percentage((mSimulationTime - previous.mTime) / (next.mTime - previous.mTime));
+			position += (next.mValue - previous.mValue) * static_cast<float>((percentage < 0.0) ? 0.0 : percentage);
+		}
+
+		SetAxisPosition(axisIndex, position);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::QueuedController::IsDue(const ControllerEvent& controllerEvent) const
+{
+	//An interpolated axis reaches an event at its time, where anything else jumps at the start of the step. Applying
+	//  an axis event early would replace the sample it is still being interpolated from.
+	const bool isInterpolated(true == mIsInterpolating && static_cast<size_t>(controllerEvent.mInput) < kNumberOfAxes);
+	return (true == isInterpolated) ? controllerEvent.mTime <= mSimulationTime : controllerEvent.mTime < mStepEndTime;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::QueuedController::ApplyEvent(const ControllerEvent& controllerEvent)
+{
+	const bool isPressed(controllerEvent.mValue > 0.5f);
+	switch (controllerEvent.mInput)
+	{
+	case ControllerInput::Throttle:
+	case ControllerInput::Brake:
+	case ControllerInput::Clutch:
+	case ControllerInput::Steering:
+		mPreviousSamples[static_cast<size_t>(controllerEvent.mInput)] = AxisSample{ controllerEvent.mTime, controllerEvent.mValue };
+		break;
+
+	case ControllerInput::Upshift:
+		//A press within this update is kept for the step, its release applied at the next update.
+		mIsUpshiftReleasePending = (false == isPressed && true == mIsUpshiftPressed);
+		mIsUpshiftPressed = mIsUpshiftPressed || isPressed;
+		SetUpshift(isPressed || mIsUpshiftReleasePending);
+		break;
+
+	case ControllerInput::Downshift:
+		mIsDownshiftReleasePending = (false == isPressed && true == mIsDownshiftPressed);
+		mIsDownshiftPressed = mIsDownshiftPressed || isPressed;
+		SetDownshift(isPressed || mIsDownshiftReleasePending);
+		break;
+
+	case ControllerInput::Shifter:
+		SetShifterPosition(controllerEvent.GetShifterPosition());
+		break;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::QueuedController::SetAxisPosition(const size_t axisIndex, const float position)
+{
+	switch (static_cast<ControllerInput>(axisIndex))
+	{
+	case ControllerInput::Throttle: SetThrottlePosition(position); break;
+	case ControllerInput::Brake: SetBrakePosition(position); break;
+	case ControllerInput::Clutch: SetClutchPosition(position); break;
+	case ControllerInput::Steering: SetSteeringPosition(position); break;
+	default: break;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,144 @@
+///
+/// @file
+/// @details Passes timestamped controller events from an input or network thread to the simulation thread, so each
+///   input is applied at the time step it happened within rather than whenever the simulation next reads it.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#ifndef _Racecar_ControllerQueue_h_
+#define _Racecar_ControllerQueue_h_
+
+#include "racecar.h"
+#include "racecar_controller.h"
+
+#include <array>
+#include <atomic>
+#include <memory>
+
+namespace Racecar
+{
+
+	enum class ControllerInput : uint8_t
+	{
+		Throttle,
+		Brake,
+		Clutch,
+		Steering,
+		Upshift,
+		Downshift,
+		Shifter,
+	};
+
+	///
+	/// @details A change to a single input of the controller at a time on the simulation clock, in seconds. Pedals and
+	///   steering take the position as the value, the shift buttons take 1 for pressed and 0 for released.
+	///
+	struct ControllerEvent
+	{
+		ControllerEvent(void);
+		ControllerEvent(const Real& time, const ControllerInput input, const float value);
+		ControllerEvent(const Real& time, const Gear& shifterPosition);
+
+		inline Gear GetShifterPosition(void) const { return static_cast<Gear>(static_cast<int>(mValue)); }
+
+		Real mTime;
+		float mValue;
+		ControllerInput mInput;
+	};
+
+	///
+	/// @details A bounded queue of controller events for exactly one producer thread and one consumer thread, neither
+	///   of which ever waits on the other. Events are pushed in the order of their time.
+	///
+	class ControllerEventQueue
+	{
+	public:
+		static const size_t kCacheLineSize = 64;
+
+		///
+		/// @param capacity The most events held at once, rounded up to a power of two.
+		///
+		explicit ControllerEventQueue(const size_t capacity = 256);
+		~ControllerEventQueue(void);
+
+		ControllerEventQueue(const ControllerEventQueue& other) = delete;
+		ControllerEventQueue& operator=(const ControllerEventQueue& other) = delete;
+
+		inline size_t GetCapacity(void) const { return mMask + 1; }
+
+		///
+		/// @details Called only from the producer thread, returns false and drops the event when the queue is full.
+		///
+		bool Push(const ControllerEvent& controllerEvent);
+
+		///
+		/// @details Called only from the consumer thread, returns false when the queue is empty.
+		///
+		bool Pop(ControllerEvent& controllerEvent);
+
+	private:
+		std::unique_ptr<ControllerEvent[]> mEvents;
+		size_t mMask;
+		alignas(kCacheLineSize) std::atomic<size_t> mHead;   //Next event to pop, written by the consumer.
+		alignas(kCacheLineSize) std::atomic<size_t> mTail;   //Next event to push, written by the producer.
+	};
+
+	///
+	/// @details Takes its controls from a ControllerEventQueue. Set the time step about to be simulated, then
+	///   UpdateControls() applies every event stamped before the end of that step, so each input takes effect from the
+	///   start of the step it happened within rather than the step after. Pedals and steering can optionally be
+	///   interpolated between events instead, looking ahead at the next event of each and taking the position at the
+	///   start of the step, so a smooth input is not held as steps of the event rate. A shift button pressed and
+	///   released within one time step is held pressed for that step and released at the next, without delaying any
+	///   other event.
+	///
+	class QueuedController : public RacecarControllerInterface
+	{
+	public:
+		explicit QueuedController(ControllerEventQueue& eventQueue, const bool isInterpolating = false);
+		virtual ~QueuedController(void);
+
+		///
+		/// @details Sets the time step the next UpdateControls() is for, from the simulation time at its start.
+		///
+		void SetTimeStep(const Real& simulationTime, const Real& fixedTime = Racecar::kFixedTimeStep);
+		inline Real GetSimulationTime(void) const { return mSimulationTime; }
+
+		inline bool IsInterpolating(void) const { return mIsInterpolating; }
+
+	protected:
+		virtual void OnUpdateControls(void) override;
+
+	private:
+		static const size_t kNumberOfAxes = 4; //Throttle, Brake, Clutch and Steering.
+
+		struct AxisSample
+		{
+			Real mTime;
+			float mValue;
+		};
+
+		bool IsDue(const ControllerEvent& controllerEvent) const;
+		void ApplyEvent(const ControllerEvent& controllerEvent);
+		void SetAxisPosition(const size_t axisIndex, const float position);
+
+		ControllerEventQueue& mEventQueue;
+		std::array<AxisSample, kNumberOfAxes> mPreviousSamples;
+		std::array<AxisSample, kNumberOfAxes> mNextSamples;
+		std::array<bool, kNumberOfAxes> mHasNextSample;
+		ControllerEvent mHeldEvent;
+		Real mSimulationTime;      //The start of the time step.
+		Real mStepEndTime;
+		bool mHasHeldEvent;
+		bool mIsInterpolating;
+		bool mIsUpshiftPressed;    //Pressed during the current update, a release waits for the next.
+		bool mIsDownshiftPressed;
+		bool mIsUpshiftReleasePending;
+		bool mIsDownshiftReleasePending;
+	};
+
+};	/* namespace Racecar */
+
+#endif /* _Racecar_ControllerQueue_h_ */
@@ -0,0 +1,321 @@
+///
+/// @file
+/// @details Connects a full drive-train from shared component specifications, and simulates it at a selectable
+///   fidelity so that less important racecars can use a cheaper model.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#include "racecar_drivetrain.h"
+#include "racecar_controller.h"
+
+#include <algorithm>
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::DrivetrainSpecification::DrivetrainSpecification(const std::shared_ptr<const EngineSpecification>& engine,
+	const std::shared_ptr<const ClutchSpecification>& clutch,
+	const std::shared_ptr<const TransmissionSpecification>& transmission,
+	const std::shared_ptr<const DifferentialSpecification>& differential,
+	const std::shared_ptr<const WheelSpecification>& wheel, const Real& bodyMass) :
+	mEngine(engine),
+	mClutch(clutch),
+	mTransmission(transmission),
+	mDifferential(differential),
+	mWheel(wheel),
+	mBodyMass(bodyMass),
+	mReflectedInertia(),
+	mKinematicTopSpeed(),
+	mKinematicAcceleration()
+{
+	error_if(nullptr == mEngine || nullptr == mClutch || nullptr == mTransmission || nullptr == mDifferential || nullptr == mWheel,
+		"DrivetrainSpecification expects a specification for each component.");
+	error_if(mBodyMass <= 0.0, "Expected a positive body mass.");
+	ComputeTables();
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::DrivetrainSpecification::ComputeTables(void)
+{
+	const Real radius(mWheel->mRadius);
+	const Real finalDriveRatio(mDifferential->mFinalDriveJoint.GetGearRatio());
+	const Real wheelSideInertia(mWheel->mMass * radius * radius + mBodyMass * radius * radius + mDifferential->mMomentOfInertia +
+		finalDriveRatio * finalDriveRatio * mTransmission->mMomentOfInertia);
+	const Real engineSideInertia(mEngine->mMomentOfInertia + mClutch->mMomentOfInertia);
+
+	const TorqueCurve& torqueCurve(mEngine->mTorqueMap.GetFullThrottleCurve());
+	const Real maximumEngineSpeed((mEngine->mMaximumEngineSpeed >= 0.0) ? mEngine->mMaximumEngineSpeed :
+		RevolutionsMinuteToRadiansSecond(torqueCurve.GetMaximumRPM()));
+
+	for (size_t gearIndex(0); gearIndex < kNumberOfGears; ++gearIndex)
+	{
+		const Gear gear(static_cast<Gear>(gearIndex));
+		if (Gear::Neutral == gear || false == mTransmission->HasGear(gear))
+		{
+			mReflectedInertia[gearIndex] = wheelSideInertia;
+			mKinematicTopSpeed[gearIndex] = 0.0;
+			mKinematicAcceleration[gearIndex].fill(0.0);
+			continue;
+		}
+
+		const Real overallRatio(fabs(GetOverallRatio(gear)));
+		mReflectedInertia[gearIndex] = wheelSideInertia + overallRatio * overallRatio * engineSideInertia;
+		mKinematicTopSpeed[gearIndex] = maximumEngineSpeed / overallRatio * radius;
+
+		//Acceleration at the wheel contact is the wheel torque divided by the effective mass, I / r^2.
+		for (size_t index(0); index < kKinematicResolution; ++index)
+		{
+			const Real linearVelocity(mKinematicTopSpeed[gearIndex] * index / static_cast<Real>(kKinematicResolution - 1));
+			const Real engineSpeed(linearVelocity / radius * overallRatio);
+			const Real engineSpeedRPM(std::max(RadiansSecondToRevolutionsMinute(engineSpeed), torqueCurve.GetMinimumRPM()));
+			const Real engineTorque(torqueCurve.GetOutputTorque(engineSpeedRPM) - mEngine->mFrictionResistance * engineSpeed);
+			mKinematicAcceleration[gearIndex][index] = engineTorque * overallRatio * radius / mReflectedInertia[gearIndex];
+		}
+	}
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::DrivetrainSpecification::GetOverallRatio(const Gear& gear) const
+{
+	return mTransmission->GetGearJoint(gear).GetGearRatio() * mDifferential->mFinalDriveJoint.GetGearRatio();
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::DrivetrainSpecification::GetKinematicAcceleration(const Gear& gear, const Real& linearVelocity) const
+{
+	const size_t gearIndex(static_cast<size_t>(gear));
+	const Real topSpeed(mKinematicTopSpeed[gearIndex]);
+	const Real speed(fabs(linearVelocity));
+	if (speed >= topSpeed)
+	{
+		return 0.0;
+	}
+
+	const Real samplePosition(speed / topSpeed * (kKinematicResolution - 1));
+	const size_t index(static_cast<size_t>(samplePosition));
+	const Real percentage(samplePosition - index);
+	const std::array<Real, kKinematicResolution>& table(mKinematicAcceleration[gearIndex]);
+	const Real acceleration(table[index] + (table[index + 1] - table[index]) * percentage);
+	return acceleration * Racecar::Sign(GetOverallRatio(gear));
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Drivetrain::Drivetrain(const std::shared_ptr<const DrivetrainSpecification>& specification, const DrivetrainFidelity fidelity) :
+	mSpecification(specification),
+	mEngine((nullptr == specification) ? nullptr : specification->mEngine),
+	mClutch((nullptr == specification) ? nullptr : specification->mClutch),
+	mTransmission((nullptr == specification) ? nullptr : specification->mTransmission),
+	mDifferential((nullptr == specification) ? nullptr : specification->mDifferential),
+	mWheel((nullptr == specification) ? nullptr : specification->mWheel),
+	mRacecarBody((nullptr == specification) ? 0.0 : specification->mBodyMass),
+	mControllerSubscription(kThrottleChannel | kBrakeChannel),
+	mThrottlePosition(0.0f),
+	mBrakePosition(0.0f),
+	mFidelity(fidelity)
+{
+	//Link up all the components:
+	mEngine.AddOutputSource(&mClutch);
+	mClutch.SetInputSource(&mEngine);
+	mClutch.AddOutputSource(&mTransmission);
+	mTransmission.SetInputSource(&mClutch);
+	mTransmission.AddOutputSource(&mDifferential);
+	mDifferential.SetInputSource(&mTransmission);
+	mDifferential.AddOutputSource(&mWheel);
+	mWheel.SetInputSource(&mDifferential);
+	mWheel.SetRacecarBody(&mRacecarBody);
+	mRacecarBody.SetWheel(0, &mWheel);
+
+	mWheel.SetOnGround(true, Racecar::Wheel::kInfiniteFriction);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Drivetrain::~Drivetrain(void)
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::Drivetrain::ControllerChange(const RacecarControllerInterface& racecarController)
+{
+	if (true == mControllerSubscription.ConsumeChanges(racecarController))
+	{
+		mThrottlePosition = racecarController.GetThrottlePosition();
+		mBrakePosition = racecarController.GetBrakePosition();
+	}
+
+	//Every fidelity relies on the components to track the clutch engagement and selected gear, each only reads the
+	//  controller when a channel it uses has changed.
+	mEngine.ControllerChange(racecarController);
+	mClutch.ControllerChange(racecarController);
+	mTransmission.ControllerChange(racecarController);
+	mDifferential.ControllerChange(racecarController);
+	mWheel.ControllerChange(racecarController);
+	mRacecarBody.ControllerChange(racecarController);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::Drivetrain::Simulate(const Real& fixedTime)
+{
+	switch (mFidelity)
+	{
+	case DrivetrainFidelity::Full: SimulateFull(fixedTime); break;
+	case DrivetrainFidelity::Reduced: SimulateReduced(fixedTime); break;
+	case DrivetrainFidelity::Kinematic: SimulateKinematic(fixedTime); break;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::Drivetrain::Reset(void)
+{
+	mTransmission.SelectGear(Gear::Neutral);
+	mThrottlePosition = 0.0f;
+	mBrakePosition = 0.0f;
+	mRacecarBody.Reset();
+	SetDrivetrainSpeeds(0.0, 0.0);
+
+	mControllerSubscription.Invalidate();
+	mEngine.ResetControllerChanges();
+	mClutch.ResetControllerChanges();
+	mTransmission.ResetControllerChanges();
+	mDifferential.ResetControllerChanges();
+	mWheel.ResetControllerChanges();
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::Drivetrain::SetLinearVelocity(const Real& linearVelocity)
+{
+	const Real wheelSpeed(linearVelocity / mWheel.GetRadius());
+	const Real engineSpeed((true == IsEngaged()) ?
+		wheelSpeed * mSpecification->GetOverallRatio(mTransmission.GetSelectedGear()) : mEngine.GetAngularVelocity());
+	SetDrivetrainSpeeds(engineSpeed, wheelSpeed);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::Drivetrain::SimulateFull(const Real& fixedTime)
+{
+	mEngine.Simulate(fixedTime);
+	mClutch.Simulate(fixedTime);
+	mTransmission.Simulate(fixedTime);
+	mDifferential.Simulate(fixedTime);
+	mWheel.Simulate(fixedTime);
+	mRacecarBody.Simulate(fixedTime);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::Drivetrain::SimulateReduced(const Real& fixedTime)
+{
+	const DrivetrainSpecification& specification(*mSpecification);
+	const EngineSpecification& engineSpecification(*specification.mEngine);
+	const Gear selectedGear(mTransmission.GetSelectedGear());
+
+	//The tires are assumed to have infinite friction, so the wheel always rolls with the racecar.
+	const Real wheelSpeed(mRacecarBody.GetLinearVelocity() / mWheel.GetRadius());
+
+	if (true == IsEngaged())
+	{
+		const Real overallRatio(specification.GetOverallRatio(selectedGear));
+		const Real reflectedInertia(specification.mReflectedInertia[static_cast<size_t>(selectedGear)]);
+		const Real engineSpeed(wheelSpeed * overallRatio);
+		const Real engineSpeedRPM(RadiansSecondToRevolutionsMinute(engineSpeed));
+		const Real resistanceTorque(-engineSpecification.mFrictionResistance * engineSpeed);
+		const auto computeEngineSpeed = [&](const Real& engineTorque) {
+			return (wheelSpeed + (engineTorque + resistanceTorque) * overallRatio * fixedTime / reflectedInertia) * overallRatio;
+		};
+
+		const Real finalEngineSpeed(engineSpecification.LimitEngineSpeed(
+			computeEngineSpeed(engineSpecification.mTorqueMap.GetOutputTorque(engineSpeedRPM, mThrottlePosition)),
+			[&]() { return computeEngineSpeed(0.0); },
+			[&]() { return computeEngineSpeed(engineSpecification.mTorqueMap.GetOutputTorque(engineSpeedRPM, 1.0f)); }));
+
+		const Real finalWheelSpeed(ApplyBrakes(finalEngineSpeed / overallRatio, reflectedInertia, fixedTime));
+		SetDrivetrainSpeeds(finalWheelSpeed * overallRatio, finalWheelSpeed);
+	}
+	else
+	{	//The engine spins freely, taking the clutch disk with it only when the clutch is engaged.
+		const Real engineInertia(engineSpecification.mMomentOfInertia +
+			((mClutch.GetClutchEngagement() >= Racecar::PercentTo(0.5)) ? specification.mClutch->mMomentOfInertia : 0.0));
+		const Real engineSpeed(mEngine.GetAngularVelocity());
+		const Real engineSpeedRPM(mEngine.GetEngineSpeedRPM());
+		const Real resistanceTorque(-engineSpecification.mFrictionResistance * engineSpeed);
+		const auto computeEngineSpeed = [&](const Real& engineTorque) {
+			return engineSpeed + (engineTorque + resistanceTorque) * fixedTime / engineInertia;
+		};
+
+		const Real finalEngineSpeed(engineSpecification.LimitEngineSpeed(
+			computeEngineSpeed(engineSpecification.mTorqueMap.GetOutputTorque(engineSpeedRPM, mThrottlePosition)),
+			[&]() { return computeEngineSpeed(0.0); },
+			[&]() { return computeEngineSpeed(engineSpecification.mTorqueMap.GetOutputTorque(engineSpeedRPM, 1.0f)); }));
+
+		const Real reflectedInertia(specification.mReflectedInertia[static_cast<size_t>(Gear::Neutral)]);
+		SetDrivetrainSpeeds(finalEngineSpeed, ApplyBrakes(wheelSpeed, reflectedInertia, fixedTime));
+	}
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::Drivetrain::SimulateKinematic(const Real& fixedTime)
+{
+	const DrivetrainSpecification& specification(*mSpecification);
+	const Gear selectedGear(mTransmission.GetSelectedGear());
+	const bool isEngaged(IsEngaged());
+
+	const Real radius(mWheel.GetRadius());
+	const Real linearVelocity(mRacecarBody.GetLinearVelocity());
+	const Real acceleration((true == isEngaged) ?
+		specification.GetKinematicAcceleration(selectedGear, linearVelocity) * mThrottlePosition : 0.0);
+
+	const Real reflectedInertia(specification.mReflectedInertia[static_cast<size_t>((true == isEngaged) ? selectedGear : Gear::Neutral)]);
+	const Real wheelSpeed(ApplyBrakes((linearVelocity + acceleration * fixedTime) / radius, reflectedInertia, fixedTime));
+	const Real engineSpeed((true == isEngaged) ?
+		wheelSpeed * specification.GetOverallRatio(selectedGear) : mEngine.GetAngularVelocity());
+	SetDrivetrainSpeeds(engineSpeed, wheelSpeed);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::Drivetrain::IsEngaged(void) const
+{
+	return Gear::Neutral != mTransmission.GetSelectedGear() && mClutch.GetClutchEngagement() >= Racecar::PercentTo(0.5);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::Drivetrain::ApplyBrakes(const Real& wheelSpeed, const Real& reflectedInertia, const Real& fixedTime) const
+{
+	const Real stoppingImpulse(reflectedInertia * wheelSpeed); //kg*m^2 / s
+	bool isLocked(false);
+	Real slipTime(0.0);
+	const Real brakingImpulse(Racecar::ComputeFrictionImpulse(stoppingImpulse, mSpecification->mWheel->mMaximumBrakingTorque * mBrakePosition,
+		1.0, 1.0, fixedTime, isLocked, slipTime));
+	return (true == isLocked) ? 0.0 : wheelSpeed - brakingImpulse / reflectedInertia;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::Drivetrain::SetDrivetrainSpeeds(const Real& engineSpeed, const Real& wheelSpeed)
+{
+	const Gear selectedGear(mTransmission.GetSelectedGear());
+	const Real transmissionSpeed(wheelSpeed * mSpecification->mDifferential->mFinalDriveJoint.GetGearRatio());
+
+	mEngine.SetAngularVelocity(engineSpeed);
+	mClutch.SetAngularVelocity((Gear::Neutral == selectedGear) ? engineSpeed : transmissionSpeed * mTransmission.GetSelectedGearRatio());
+	mTransmission.SetAngularVelocity(transmissionSpeed);
+	mDifferential.SetAngularVelocity(wheelSpeed);
+	mWheel.SetAngularVelocity(wheelSpeed);
+	mRacecarBody.SetLinearVelocity(wheelSpeed * mWheel.GetRadius());
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
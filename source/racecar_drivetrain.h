@@ -0,0 +1,168 @@
+///
+/// @file
+/// @details Connects a full drive-train from shared component specifications, and simulates it at a selectable
+///   fidelity so that less important racecars can use a cheaper model.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#ifndef _Racecar_Drivetrain_h_
+#define _Racecar_Drivetrain_h_
+
+#include "racecar.h"
+#include "racecar_engine.h"
+#include "racecar_clutch.h"
+#include "racecar_transmission.h"
+#include "racecar_locked_differential.h"
+#include "racecar_wheel.h"
+#include "racecar_body.h"
+
+#include <array>
+#include <memory>
+
+namespace Racecar
+{
+	class RacecarControllerInterface;
+
+	///
+	/// @details The level of detail used to simulate a Drivetrain.
+	///
+	enum class DrivetrainFidelity
+	{
+		Full,       //Each component is simulated, including clutch slip, synchromesh and tire friction.
+		Reduced,    //The drive-train is locked into a single body with the inertia reflected through the gear ratios.
+		Kinematic,  //The speed of the racecar follows acceleration tables computed from the torque curve and ratios.
+	};
+
+	///
+	/// @details The description of an entire drive-train which does not change while simulating, a single
+	///   specification can be shared by every racecar of the same model.
+	///
+	struct DrivetrainSpecification
+	{
+		static const size_t kNumberOfGears = static_cast<size_t>(Gear::Reverse) + 1;
+		static const size_t kKinematicResolution = 64;
+
+		explicit DrivetrainSpecification(const std::shared_ptr<const EngineSpecification>& engine,
+			const std::shared_ptr<const ClutchSpecification>& clutch,
+			const std::shared_ptr<const TransmissionSpecification>& transmission,
+			const std::shared_ptr<const DifferentialSpecification>& differential,
+			const std::shared_ptr<const WheelSpecification>& wheel, const Real& bodyMass);
+
+		///
+		/// @details Returns the ratio from the engine to the wheel for the gear, including the final drive. The gear is
+		///   expected to exist in the transmission and not be Neutral.
+		///
+		Real GetOverallRatio(const Gear& gear) const;
+
+		///
+		/// @details Returns the acceleration, in meters / second / second, of the racecar at full throttle in the gear
+		///   while travelling at the linear velocity, which is zero once the engine would be past the maximum speed.
+		///
+		Real GetKinematicAcceleration(const Gear& gear, const Real& linearVelocity) const;
+
+		///
+		/// @details Computes the reflected inertia and kinematic tables from the component specifications. This is done
+		///   on construction and only needs to be called again if a component specification is changed in place, which
+		///   is only safe while no other drive-train shares it, such as the candidates of the GearRatioOptimizer.
+		///
+		void ComputeTables(void);
+
+		std::shared_ptr<const EngineSpecification> mEngine;
+		std::shared_ptr<const ClutchSpecification> mClutch;
+		std::shared_ptr<const TransmissionSpecification> mTransmission;
+		std::shared_ptr<const DifferentialSpecification> mDifferential;
+		std::shared_ptr<const WheelSpecification> mWheel;
+		Real mBodyMass;                                              //kg, without the wheel.
+
+		std::array<Real, kNumberOfGears> mReflectedInertia;          //kg-m^2 at the wheel, with the clutch engaged, by Gear.
+		std::array<Real, kNumberOfGears> mKinematicTopSpeed;         //meters / second
+		std::array<std::array<Real, kKinematicResolution>, kNumberOfGears> mKinematicAcceleration;
+	};
+
+	class Drivetrain
+	{
+	public:
+		explicit Drivetrain(const std::shared_ptr<const DrivetrainSpecification>& specification,
+			const DrivetrainFidelity fidelity = DrivetrainFidelity::Full);
+		~Drivetrain(void);
+
+		Drivetrain(const Drivetrain& other) = delete;
+		Drivetrain& operator=(const Drivetrain& other) = delete;
+
+		void ControllerChange(const RacecarControllerInterface& racecarController);
+		void Simulate(const Real& fixedTime = Racecar::kFixedTimeStep);
+
+		///
+		/// @details Returns the drive-train to a standstill in neutral with the controls released, and the racecar body
+		///   to the start of the track, so a drive-train can be reused from the start without constructing another. The
+		///   next ControllerChange() reads every control again, even those that have not changed.
+		///
+		void Reset(void);
+
+		inline DrivetrainFidelity GetFidelity(void) const { return mFidelity; }
+
+		///
+		/// @details Changes how the drive-train is simulated, this can be changed at any time. The speeds of each
+		///   component are kept by the components in every fidelity, so the state carries across. This only selects
+		///   the fidelity, after locking into the Reduced or Kinematic fidelity the engine is matched to the speed of
+		///   the racecar by the next Simulate().
+		///
+		inline void SetFidelity(const DrivetrainFidelity fidelity) { mFidelity = fidelity; }
+
+		///
+		/// @details Immediately sets the speed of the racecar in meters / second, the wheel and every component
+		///   connected to it through the selected gear are set to match.
+		///
+		void SetLinearVelocity(const Real& linearVelocity);
+		inline const Real& GetLinearVelocity(void) const { return mRacecarBody.GetLinearVelocity(); }
+
+		inline const std::shared_ptr<const DrivetrainSpecification>& GetSpecification(void) const { return mSpecification; }
+
+		inline const Engine& GetEngine(void) const { return mEngine; }
+		inline Engine& GetEngine(void) { return mEngine; }
+		inline const Clutch& GetClutch(void) const { return mClutch; }
+		inline const Transmission& GetTransmission(void) const { return mTransmission; }
+		inline Transmission& GetTransmission(void) { return mTransmission; }
+		inline const LockedDifferential& GetDifferential(void) const { return mDifferential; }
+		inline const Wheel& GetWheel(void) const { return mWheel; }
+		inline Wheel& GetWheel(void) { return mWheel; }
+		inline const RacecarBody& GetRacecarBody(void) const { return mRacecarBody; }
+
+	private:
+		void SimulateFull(const Real& fixedTime);
+		void SimulateReduced(const Real& fixedTime);
+		void SimulateKinematic(const Real& fixedTime);
+
+		///
+		/// @details True when the engine is connected to the wheel through the clutch and a selected gear.
+		///
+		bool IsEngaged(void) const;
+
+		///
+		/// @details Returns the wheel speed after the brakes have been applied for the time step, without reversing.
+		///
+		Real ApplyBrakes(const Real& wheelSpeed, const Real& reflectedInertia, const Real& fixedTime) const;
+
+		///
+		/// @details Writes the speed of every component from the engine speed and wheel speed.
+		///
+		void SetDrivetrainSpeeds(const Real& engineSpeed, const Real& wheelSpeed);
+
+		std::shared_ptr<const DrivetrainSpecification> mSpecification;
+		Engine mEngine;
+		Clutch mClutch;
+		Transmission mTransmission;
+		LockedDifferential mDifferential;
+		Wheel mWheel;
+		RacecarBody mRacecarBody;
+		ControllerSubscription mControllerSubscription;
+		float mThrottlePosition;
+		float mBrakePosition;
+		DrivetrainFidelity mFidelity;
+	};
+
+};	/* namespace Racecar */
+
+#endif /* _Racecar_Drivetrain_h_ */
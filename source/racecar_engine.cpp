@@ -10,11 +10,12 @@
 #include "racecar_controller.h"
 
 #include <algorithm>
+#include <cstdint>
 
 //-------------------------------------------------------------------------------------------------------------------//
 
 Racecar::ConstantEngine::ConstantEngine(const Real& momentOfInertia, const Real& constantTorque, const Real& resistanceTorque) :
-	RotatingBody(momentOfInertia),
+	RotatingBody(momentOfInertia, kThrottleChannel),
 	mConstantTorque(constantTorque),
 	mResistanceTorque(resistanceTorque),
 	mThrottlePosition(0.0)
@@ -73,144 +74,303 @@ Racecar::Real Racecar::ConstantEngine::GetEngineSpeedRPM(void) const
 //-------------------------------------------------------------------------------------------------------------------//
 //-------------------------------------------------------------------------------------------------------------------//
 
-Racecar::TorqueCurve Racecar::TorqueCurve::MiataTorqueCurve(void)
-{	//http://www.automobile-catalog.com/curve/1999/1667030/mazda_mx-5_1_9.html
-	TorqueCurve curve;
-	curve.AddPlotPoint(500, 25.0);
-	curve.AddPlotPoint(1000, 75.0);
-	curve.AddPlotPoint(1500, 112.0);
-	curve.AddPlotPoint(2000, 130.0);
-	curve.AddPlotPoint(2500, 137.0);
-	curve.AddPlotPoint(3000, 150.0);
-	curve.AddPlotPoint(3500, 155.0);
-	curve.AddPlotPoint(4000, 158.0);
-	curve.AddPlotPoint(4500, 162.0);
-	curve.AddPlotPoint(5000, 160.0);
-	curve.AddPlotPoint(5500, 159.0);
-	curve.AddPlotPoint(6000, 156.5);
-	curve.AddPlotPoint(6500, 151.0);
-	curve.AddPlotPoint(7000, 127.0);
-	curve.AddPlotPoint(7500, 25.0);
-	curve.AddPlotPoint(8000, 0.0);
-	curve.NormalizeTorqueCurve();
-	return curve;
+namespace
+{
+	//http://www.automobile-catalog.com/curve/1999/1667030/mazda_mx-5_1_9.html
+	constexpr Racecar::TorqueCurve kMiataTorqueCurve({
+		{ 500, 25.0 }, { 1000, 75.0 }, { 1500, 112.0 }, { 2000, 130.0 },
+		{ 2500, 137.0 }, { 3000, 150.0 }, { 3500, 155.0 }, { 4000, 158.0 },
+		{ 4500, 162.0 }, { 5000, 160.0 }, { 5500, 159.0 }, { 6000, 156.5 },
+		{ 6500, 151.0 }, { 7000, 127.0 }, { 7500, 25.0 }, { 8000, 0.0 },
+	});
+};
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+const Racecar::TorqueCurve& Racecar::TorqueCurve::MiataTorqueCurve(void)
+{
+	return kMiataTorqueCurve;
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
 
-Racecar::TorqueCurve::TorqueCurve(void) :
-	mTorqueTable(),
-	mMaximumTorque(0.0),
-	mIsNormalized(false)
+Racecar::Real Racecar::TorqueCurve::GetMaximumTorque(void) const
 {
+	return mMaximumTorque;
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
 
-Racecar::TorqueCurve::~TorqueCurve(void)
+Racecar::Real Racecar::TorqueCurve::GetOutputTorque(const Real engineSpeedRPM) const
 {
+	error_if(false == mIsNormalized, "Cannot get output of a TorqueCurve that has not been normalized. Call NormalizeTorqueCurve().");
+	return GetOutputValue(engineSpeedRPM) * mMaximumTorque;
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
 
-void Racecar::TorqueCurve::AddPlotPoint(const Racecar::Real engineSpeedRPM, const Racecar::Real torque)
+void Racecar::TorqueCurve::GetOutputTorques(const Real* engineSpeedsRPM, Real* __restrict outputTorques, const size_t count) const
 {
-	error_if(true == mIsNormalized, "Cannot add more plot points to a table that is already normalized.");
-	error_if(engineSpeedRPM < 0.0, "Cannot add plot point for engine speeds less than zero.");
-	error_if(torque < 0.0, "Cannot add plot point for torque amounts that are less than zero.");
+	error_if(false == mIsNormalized, "Cannot get output of a TorqueCurve that has not been normalized. Call NormalizeTorqueCurve().");
+
+	//The members are copied so they are not loaded again after each store, and the clamps are selects on values,
+	//  as std::min() and std::max() select between references. The clamped position is never negative, so truncating
+	//  it is the floor without std::floor(), which is not vectorized unless the math may be relaxed.
+	const Real* const lookupTable(mLookupTable.data());
+	const Real minimumRPM(mMinimumRPM);
+	const Real maximumRPM(mMaximumRPM);
+	const Real samplesPerRPM(mSamplesPerRPM);
+	const Real maximumTorque(mMaximumTorque);
+	const int32_t lastIndex(static_cast<int32_t>(mTableResolution - 2));
+	for (size_t speedIndex(0); speedIndex < count; ++speedIndex)
+	{
+		const Real engineSpeedRPM(engineSpeedsRPM[speedIndex]);
+		const Real clampedRPM((engineSpeedRPM < minimumRPM) ? minimumRPM : (engineSpeedRPM > maximumRPM) ? maximumRPM : engineSpeedRPM);
+		const Real position((clampedRPM - minimumRPM) * samplesPerRPM);
+		const int32_t truncatedIndex(static_cast<int32_t>(position));
+		const int32_t index((truncatedIndex < lastIndex) ? truncatedIndex : lastIndex);
+		const Real percentage(position - static_cast<Real>(index));
+		outputTorques[speedIndex] = (lookupTable[index] + (lookupTable[index + 1] - lookupTable[index]) * percentage) * maximumTorque;
+	}
+}
 
-	auto findItr = std::find_if(mTorqueTable.begin(), mTorqueTable.end(), [engineSpeedRPM](PlotPoint& pt) { return fabs(pt.first - engineSpeedRPM) < 0.1; });
-	error_if(mTorqueTable.end() != findItr, "Cannot plot a point on top of another point!");
+//-------------------------------------------------------------------------------------------------------------------//
 
-	PlotPoint pt(engineSpeedRPM, torque);
-	mTorqueTable.push_back(pt);
+Racecar::Real Racecar::TorqueCurve::GetOutputValue(const Real engineSpeedRPM) const
+{
+	const Real clampedRPM(std::min(std::max(engineSpeedRPM, mMinimumRPM), mMaximumRPM));
+	const Real position((clampedRPM - mMinimumRPM) * mSamplesPerRPM);
+	const Real tableIndex(std::min(std::floor(position), static_cast<Real>(mTableResolution - 2)));
+	const size_t index(static_cast<size_t>(tableIndex));
+	const Real percentage(position - tableIndex);
+	return mLookupTable[index] + (mLookupTable[index + 1] - mLookupTable[index]) * percentage;
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
 
-void Racecar::TorqueCurve::NormalizeTorqueCurve(void)
+Racecar::Real Racecar::TorqueCurve::GetMaximumRPM(void) const
 {
-	error_if(true == mTorqueTable.empty(), "Cannot normalize a table without plotted points. Call AddPlotPoint() to make it interesting.");
+	error_if(false == mIsNormalized, "Cannot get the Maximum RPM of a TorqueCurve that has not been normalized. Call NormalizeTorqueCurve().");
+	return mMaximumRPM;
+}
 
-	std::sort(mTorqueTable.begin(), mTorqueTable.end(), [](PlotPoint& a, PlotPoint& b) { return a.second < b.second; });
-	mMaximumTorque = mTorqueTable.back().second;
+//-------------------------------------------------------------------------------------------------------------------//
 
-	std::sort(mTorqueTable.begin(), mTorqueTable.end(), [](PlotPoint& a, PlotPoint& b) { return a.first < b.first; });
-	std::for_each(mTorqueTable.begin(), mTorqueTable.end(), [this](PlotPoint& pt) { pt.second /= mMaximumTorque; });
+Racecar::Real Racecar::TorqueCurve::GetMinimumRPM(void) const
+{
+	error_if(false == mIsNormalized, "Cannot get the Minimum RPM of a TorqueCurve that has not been normalized. Call NormalizeTorqueCurve().");
+	return mMinimumRPM;
+}
 
-	mIsNormalized = true;
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::TorqueMap Racecar::TorqueMap::FromTorqueCurve(const TorqueCurve& fullThrottleCurve)
+{
+	TorqueMap torqueMap;
+	torqueMap.AddThrottleCurve(1.0, fullThrottleCurve);
+	torqueMap.NormalizeTorqueMap(fullThrottleCurve.GetTableResolution(), 2);
+	return torqueMap;
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
 
-Racecar::Real Racecar::TorqueCurve::GetMaximumTorque(void) const
+Racecar::TorqueMap::TorqueMap(void) :
+	mThrottleCurves(),
+	mFullThrottleCurve(),
+	mTorqueTable(),
+	mEngineSpeedResolution(0),
+	mThrottleResolution(0),
+	mMinimumRPM(0.0),
+	mMaximumRPM(0.0),
+	mSamplesPerRPM(0.0),
+	mIsNormalized(false)
 {
-	return mMaximumTorque;
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
 
-Racecar::Real Racecar::TorqueCurve::GetOutputTorque(const Real engineSpeedRPM) const
+Racecar::TorqueMap::~TorqueMap(void)
 {
-	return GetOutputValue(engineSpeedRPM) * mMaximumTorque;
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
 
-Racecar::Real Racecar::TorqueCurve::GetOutputValue(const Real engineSpeedRPM) const
+void Racecar::TorqueMap::AddThrottleCurve(const Real throttlePosition, const TorqueCurve& torqueCurve)
 {
-	error_if(false == mIsNormalized, "Cannot get output of a TorqueCurve that has not been normalized. Call NormalizeTorqueCurve().");
+	error_if(true == mIsNormalized, "Cannot add more throttle curves to a map that is already normalized.");
+	error_if(throttlePosition < 0.0 || throttlePosition > 1.0, "Cannot add a throttle curve outside of the 0.0 to 1.0 throttle range.");
+	error_if(false == torqueCurve.IsNormalized(), "TorqueMap expects each TorqueCurve to be normalized / finalized.");
 
-	PlotPoint previousPoint = mTorqueTable.front();
-	if (engineSpeedRPM < previousPoint.first)
-	{	//The RPM of the engine is lower than the lowest in torque table.
-		return previousPoint.second;
-	}
+	auto findItr = std::find_if(mThrottleCurves.begin(), mThrottleCurves.end(), [throttlePosition](ThrottleCurve& curve) { return fabs(curve.first - throttlePosition) < kEpsilon; });
+	error_if(mThrottleCurves.end() != findItr, "Cannot add a throttle curve on top of another throttle curve!");
+
+	mThrottleCurves.push_back(ThrottleCurve(throttlePosition, torqueCurve));
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
 
-	for (size_t index(1); index < kTorqueTableSize; ++index)
+void Racecar::TorqueMap::NormalizeTorqueMap(const size_t engineSpeedResolution, const size_t throttleResolution)
+{
+	error_if(engineSpeedResolution < 2 || throttleResolution < 2, "Cannot normalize a map with a resolution less than 2 samples.");
+
+	std::sort(mThrottleCurves.begin(), mThrottleCurves.end(), [](ThrottleCurve& a, ThrottleCurve& b) { return a.first < b.first; });
+	error_if(true == mThrottleCurves.empty() || fabs(mThrottleCurves.back().first - 1.0) > kEpsilon,
+		"Cannot normalize a map without a full throttle curve. Call AddThrottleCurve(1.0, curve).");
+
+	mMinimumRPM = mThrottleCurves.front().second.GetMinimumRPM();
+	mMaximumRPM = mThrottleCurves.front().second.GetMaximumRPM();
+	for (const ThrottleCurve& throttleCurve : mThrottleCurves)
 	{
-		const PlotPoint& currentPoint(mTorqueTable[index]);
-		const Real& currentRPM(currentPoint.first);
-		const Real& currentTorque(currentPoint.second);
+		mMinimumRPM = std::min(mMinimumRPM, throttleCurve.second.GetMinimumRPM());
+		mMaximumRPM = std::max(mMaximumRPM, throttleCurve.second.GetMaximumRPM());
+	}
 
-		if (engineSpeedRPM > currentRPM)
+	const Real rpmPerSample((mMaximumRPM - mMinimumRPM) / static_cast<Real>(engineSpeedResolution - 1));
+	mSamplesPerRPM = (rpmPerSample > kEpsilon) ? 1.0 / rpmPerSample : 0.0;
+	mEngineSpeedResolution = engineSpeedResolution;
+	mThrottleResolution = throttleResolution;
+
+	mTorqueTable.resize(mEngineSpeedResolution * mThrottleResolution);
+	for (size_t throttleIndex(0); throttleIndex < mThrottleResolution; ++throttleIndex)
+	{
+		const Real throttlePosition(static_cast<Real>(throttleIndex) / static_cast<Real>(mThrottleResolution - 1));
+		for (size_t rpmIndex(0); rpmIndex < mEngineSpeedResolution; ++rpmIndex)
 		{
-			previousPoint = currentPoint;
-			continue;
+			const Real engineSpeedRPM(mMinimumRPM + rpmPerSample * static_cast<Real>(rpmIndex));
+			mTorqueTable[throttleIndex * mEngineSpeedResolution + rpmIndex] = ComputeTorqueFromCurves(engineSpeedRPM, throttlePosition);
 		}
+	}
+
+	mFullThrottleCurve = mThrottleCurves.back().second;
+	mThrottleCurves.clear();
+	mIsNormalized = true;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::TorqueMap::ComputeTorqueFromCurves(const Real engineSpeedRPM, const Real throttlePosition) const
+{
+	//The curves are sorted by throttle position, and the last is always at full throttle, so find the first curve at or
+	//above the throttle position and interpolate from the curve below it, or from no torque at a closed throttle.
+	size_t curveIndex(0);
+	while (mThrottleCurves[curveIndex].first < throttlePosition - kEpsilon)
+	{
+		++curveIndex;
+	}
 
-		const Real& previousRPM(previousPoint.first);
-		const Real& previousTorque(previousPoint.second);
-		const Real percentage = 1.0 - ((currentRPM - engineSpeedRPM) / (currentRPM - previousRPM));
-		return previousTorque + ((currentTorque - previousTorque) * percentage);
+	const ThrottleCurve& upperCurve(mThrottleCurves[curveIndex]);
+	const Real upperTorque(upperCurve.second.GetOutputTorque(engineSpeedRPM));
+	if (fabs(upperCurve.first - throttlePosition) < kEpsilon)
+	{
+		return upperTorque;
 	}
 
-	warning_if(true, "Value not found for RPM: %f in torque table.", engineSpeedRPM);
-	return mTorqueTable.back().second;
+	const Real lowerThrottle((0 == curveIndex) ? 0.0 : mThrottleCurves[curveIndex - 1].first);
+	const Real lowerTorque((0 == curveIndex) ? 0.0 : mThrottleCurves[curveIndex - 1].second.GetOutputTorque(engineSpeedRPM));
+	const Real percentage((throttlePosition - lowerThrottle) / (upperCurve.first - lowerThrottle));
+	return lowerTorque + (upperTorque - lowerTorque) * percentage;
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
 
-Racecar::Real Racecar::TorqueCurve::GetMaximumRPM(void) const
+Racecar::Real Racecar::TorqueMap::GetOutputTorque(const Real engineSpeedRPM, const Real throttlePosition) const
 {
-	error_if(false == mIsNormalized, "Cannot get the Maximum RPM of a TorqueCurve that has not been normalized. Call NormalizeTorqueCurve().");
-	return mTorqueTable.back().first;
+	Real torqueSlope(0.0);
+	return GetOutputTorque(engineSpeedRPM, throttlePosition, torqueSlope);
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::TorqueMap::GetOutputTorque(const Real engineSpeedRPM, const Real throttlePosition, Real& torqueSlope) const
+{
+	error_if(false == mIsNormalized, "Cannot get output of a TorqueMap that has not been normalized. Call NormalizeTorqueMap().");
+
+	const Real clampedRPM(std::min(std::max(engineSpeedRPM, mMinimumRPM), mMaximumRPM));
+	const Real rpmPosition((clampedRPM - mMinimumRPM) * mSamplesPerRPM);
+	const Real rpmTableIndex(std::min(std::floor(rpmPosition), static_cast<Real>(mEngineSpeedResolution - 2)));
+	const Real rpmPercentage(rpmPosition - rpmTableIndex);
+
+	const Real clampedThrottle(std::min(std::max(throttlePosition, Real(0.0)), Real(1.0)));
+	const Real throttleSamplePosition(clampedThrottle * static_cast<Real>(mThrottleResolution - 1));
+	const Real throttleTableIndex(std::min(std::floor(throttleSamplePosition), static_cast<Real>(mThrottleResolution - 2)));
+	const Real throttlePercentage(throttleSamplePosition - throttleTableIndex);
+
+	const Real* const lowerRow(&mTorqueTable[static_cast<size_t>(throttleTableIndex) * mEngineSpeedResolution + static_cast<size_t>(rpmTableIndex)]);
+	const Real* const upperRow(lowerRow + mEngineSpeedResolution);
+	const Real lowerDifference(lowerRow[1] - lowerRow[0]);
+	const Real upperDifference(upperRow[1] - upperRow[0]);
+	const Real lowerTorque(lowerRow[0] + lowerDifference * rpmPercentage);
+	const Real upperTorque(upperRow[0] + upperDifference * rpmPercentage);
+
+	torqueSlope = (engineSpeedRPM < mMinimumRPM || engineSpeedRPM > mMaximumRPM) ? 0.0 :
+		(lowerDifference + (upperDifference - lowerDifference) * throttlePercentage) * mSamplesPerRPM;
+	return lowerTorque + (upperTorque - lowerTorque) * throttlePercentage;
+}
+
 //-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::TorqueMap::GetMaximumTorque(void) const
+{
+	error_if(false == mIsNormalized, "Cannot get the Maximum Torque of a TorqueMap that has not been normalized. Call NormalizeTorqueMap().");
+	return mFullThrottleCurve.GetMaximumTorque();
+}
+
 //-------------------------------------------------------------------------------------------------------------------//
 
-Racecar::Engine::Engine(const Real& momentOfInertia, const TorqueCurve& torqueCurve) :
-	RotatingBody(momentOfInertia),
-	mTorqueCurve(torqueCurve),
+Racecar::Real Racecar::TorqueMap::GetMaximumRPM(void) const
+{
+	error_if(false == mIsNormalized, "Cannot get the Maximum RPM of a TorqueMap that has not been normalized. Call NormalizeTorqueMap().");
+	return mMaximumRPM;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+const Racecar::TorqueCurve& Racecar::TorqueMap::GetFullThrottleCurve(void) const
+{
+	error_if(false == mIsNormalized, "Cannot get the full throttle curve of a TorqueMap that has not been normalized. Call NormalizeTorqueMap().");
+	return mFullThrottleCurve;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::EngineSpecification::EngineSpecification(const Real& momentOfInertia, const TorqueMap& torqueMap) :
+	RotatingBodySpecification(momentOfInertia),
+	mTorqueMap(torqueMap),
 	mFrictionResistance(0.0),
 	mMinimumEngineSpeed(-1.0),
 	mMaximumEngineSpeed(-1.0),
-	mThrottlePosition(0.0f),
 	mConstantPower(true)
 {
-	error_if(false == mTorqueCurve.IsNormalized(), "Engine expects the TorqueCurve to be normalized / finalized.");
+	error_if(false == mTorqueMap.IsNormalized(), "Engine expects the TorqueMap to be normalized / finalized.");
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Engine::Engine(const Real& momentOfInertia, const TorqueCurve& torqueCurve) :
+	Engine(std::make_shared<const EngineSpecification>(momentOfInertia, TorqueMap::FromTorqueCurve(torqueCurve)))
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Engine::Engine(const Real& momentOfInertia, const TorqueMap& torqueMap) :
+	Engine(std::make_shared<const EngineSpecification>(momentOfInertia, torqueMap))
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Engine::Engine(const std::shared_ptr<const EngineSpecification>& specification) :
+	RotatingBody(specification, kThrottleChannel),
+	mThrottlePosition(0.0f),
+	mIntegration(EngineIntegration::Explicit)
+{
 	SetAngularVelocity(Racecar::RevolutionsMinuteToRadiansSecond(1000.0));
 }
 
@@ -231,44 +391,80 @@ void Racecar::Engine::OnControllerChange(const Racecar::RacecarControllerInterfa
 
 void Racecar::Engine::OnSimulate(const Real& fixedTime)
 {
-	if (mMaximumEngineSpeed < 0.0 || GetAngularVelocity() < mMaximumEngineSpeed)
-	{
-		const Real onThrottleTorque(mTorqueCurve.GetOutputTorque(GetEngineSpeedRPM()) * mThrottlePosition);
-		const Real appliedEngineTorque(onThrottleTorque);
-
-		if (GetAngularVelocity() < 1.0 || true == mConstantPower)
-		{
-			ApplyDownstreamAngularImpulse(appliedEngineTorque * fixedTime);
-		}
-		else
-		{	//Power = Work / Time  which is  Nm / s    engineTorque is in Nm,  AngularVel is rad/s (or 1/s)
-			const Real power = appliedEngineTorque * (GetAngularVelocity());  //Nm * rad/s = kg*m^2/s^3
-			const Real work = power * fixedTime;                              //Work = Nm,  Power * time = kg*m^2/s^3 * s = kg*m^2/s^2 = Nm
-			ApplyDownstreamAngularImpulse(work * fixedTime);                  //Finally Nm * time = impulse
-		}
+	const EngineSpecification& specification(GetSpecificationAs<EngineSpecification>());
+	const Real angularVelocity(GetAngularVelocity());
+	const Real totalInertia(ComputeDownstreamInertia());
+
+	//The rev limiter and idle governor are velocity bounds on the engine, solved with the impulse from the engine
+	//torque and friction so a single impulse is applied. The rev limiter can only cut the engine torque, and the
+	//idle governor can only open the throttle, so each bound is only reached when that would be enough.
+	//The bounds are not part of the coupled clutch and gear joint solve, which may still move the engine past them.
+	Real finalAngularVelocity(angularVelocity);
+	if (EngineIntegration::AnalyticWhenDecoupled == mIntegration && true == specification.mConstantPower &&
+		false == HasDownstreamLoad())
+	{	//No load is connected, the engine torque and friction resistance can be integrated together exactly.
+		finalAngularVelocity = specification.LimitEngineSpeed(
+			ComputeDecoupledAngularVelocity(fixedTime, totalInertia, mThrottlePosition, true),
+			[&]() { return ComputeDecoupledAngularVelocity(fixedTime, totalInertia, 0.0f, false); },
+			[&]() { return ComputeDecoupledAngularVelocity(fixedTime, totalInertia, 1.0f, true); });
 	}
-	
-	//if (mThrottlePosition < 0.01)
+	else
 	{
-		const Real engineResistanceTorque(GetAngularVelocity() * mFrictionResistance);
-		ApplyDownstreamAngularImpulse(-engineResistanceTorque * fixedTime);
+		const bool isConstantPower(angularVelocity < 1.0 || true == specification.mConstantPower);
+		const Real engineSpeedRPM(GetEngineSpeedRPM());
+		const auto computeEngineImpulse = [&](const Real& engineTorque) {
+			if (true == isConstantPower)
+			{
+				return engineTorque * fixedTime;
+			}
+
+			//Power = Work / Time  which is  Nm / s    engineTorque is in Nm,  AngularVel is rad/s (or 1/s)
+			const Real power = engineTorque * angularVelocity;  //Nm * rad/s = kg*m^2/s^3
+			const Real work = power * fixedTime;               //Work = Nm,  Power * time = kg*m^2/s^3 * s = kg*m^2/s^2 = Nm
+			return work * fixedTime;                           //Finally Nm * time = impulse
+		};
+
+		const Real resistanceImpulse(-angularVelocity * specification.mFrictionResistance * fixedTime);
+		const Real engineImpulse(computeEngineImpulse(specification.mTorqueMap.GetOutputTorque(engineSpeedRPM, mThrottlePosition)));
+
+		finalAngularVelocity = specification.LimitEngineSpeed(
+			angularVelocity + (engineImpulse + resistanceImpulse) / totalInertia,
+			[&]() { return angularVelocity + resistanceImpulse / totalInertia; },
+			[&]() { return angularVelocity + (computeEngineImpulse(specification.mTorqueMap.GetOutputTorque(engineSpeedRPM, 1.0f)) +
+				resistanceImpulse) / totalInertia; });
 	}
 
+	//The total inertia is already known, so the change in velocity is applied directly instead of as an impulse.
+	OnDownstreamAngularVelocityChange(finalAngularVelocity - angularVelocity);
+
 	//Now that all torques have been applied to the engine, step it forward in time.
 	RotatingBody::OnSimulate(fixedTime);
+}
 
-	//
-	//Create a fictional force to keep the engine from stalling out. This is NOT simulation quality here...
-	//          divide 2pi to go to rev, multiply 60 to go min.
-	if (mMinimumEngineSpeed > 0.0)
-	{
-		const Real differenceTo1000((GetAngularVelocity() - mMinimumEngineSpeed) / 6.28 * 60);
-		if (differenceTo1000 < 0.0)
-		{
-			const Real totalInertia(ComputeDownstreamInertia());
-			ApplyDownstreamAngularImpulse(-differenceTo1000 * fixedTime * totalInertia);
-		}
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::Engine::ComputeDecoupledAngularVelocity(const Real& fixedTime, const Real& totalInertia,
+	const float throttlePosition, const bool isProducingTorque) const
+{
+	const EngineSpecification& specification(GetSpecificationAs<EngineSpecification>());
+	const Real angularVelocity(GetAngularVelocity());
+
+	Real engineTorque(0.0);
+	Real engineTorqueSlope(0.0); //Nm per rad/s
+	if (true == isProducingTorque)
+	{	//The map is linear within each cell, so the slope of the cell holding the engine speed is exact until the step
+		//  carries the engine into the next cell, past which the linearization is an approximation.
+		Real torqueSlopePerRPM(0.0);
+		engineTorque = specification.mTorqueMap.GetOutputTorque(GetEngineSpeedRPM(), throttlePosition, torqueSlopePerRPM);
+		engineTorqueSlope = torqueSlopePerRPM / RevolutionsMinuteToRadiansSecond(1.0);
 	}
+
+	//  dw/dt = a + b * (w - w0)   where  a = (T - c * w0) / I   and   b = (T' - c) / I
+	//  w(h) = w0 + a * (e^(b*h) - 1) / b      which approaches  w0 + a * h  as b approaches zero.
+	const Real acceleration((engineTorque - specification.mFrictionResistance * angularVelocity) / totalInertia);
+	const Real rate((engineTorqueSlope - specification.mFrictionResistance) / totalInertia);
+	const Real effectiveTime((fabs(rate * fixedTime) < kEpsilon) ? fixedTime : std::expm1(rate * fixedTime) / rate);
+	return angularVelocity + acceleration * effectiveTime;
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
@@ -283,35 +479,36 @@ Racecar::Real Racecar::Engine::GetEngineSpeedRPM(void) const
 void Racecar::Engine::SetEngineFrictionResistance(const Real& frictionResistance)
 {
 	error_if(frictionResistance < 0.0, "Expected resistance to be a positive value.");
-	mFrictionResistance = frictionResistance;
+	ModifySpecification(&EngineSpecification::mFrictionResistance, frictionResistance);
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
 
 void Racecar::Engine::SetMinimumEngineSpeed(const Real& speedRadiansPerSecond)
 {
-	mMinimumEngineSpeed = speedRadiansPerSecond;
+	ModifySpecification(&EngineSpecification::mMinimumEngineSpeed, speedRadiansPerSecond);
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
 
 void Racecar::Engine::SetMaximumEngineSpeed(const Real& speedRadiansPerSecond)
 {
-	mMaximumEngineSpeed = speedRadiansPerSecond;
+	ModifySpecification(&EngineSpecification::mMaximumEngineSpeed, speedRadiansPerSecond);
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
 
 void Racecar::Engine::SetConstantPower(const bool constantPower)
 {
-	mConstantPower = constantPower;
+	ModifySpecification(&EngineSpecification::mConstantPower, constantPower);
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
 
-Racecar::TorqueCurve Racecar::Engine::GetTorqueCurve(void) const
+const Racecar::TorqueCurve& Racecar::Engine::GetTorqueCurve(void) const
 {
-	return mTorqueCurve;
+	return GetTorqueMap().GetFullThrottleCurve();
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
+
@@ -12,6 +12,8 @@
 #include "rotating_body.h"
 
 #include <array>
+#include <initializer_list>
+#include <memory>
 
 namespace Racecar
 {
@@ -37,13 +39,39 @@ namespace Racecar
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+	///
+	/// @details A torque curve is stored entirely in fixed size arrays so it can be built, normalized and resampled at
+	///   compile time, a curve declared constexpr costs nothing at startup and never touches the heap. Errors in the
+	///   plotted points of a constexpr curve fail to compile instead of throwing at runtime.
+	///
 	class TorqueCurve
 	{
 	public:
-		static TorqueCurve MiataTorqueCurve(void);
+		struct PlotPoint
+		{
+			Real mEngineSpeedRPM;
+			Real mTorque;          //In Nm until normalized, then 0.0 to 1.0 of the maximum torque.
+		};
 
-		TorqueCurve(void);
-		~TorqueCurve(void);
+		static const size_t kMaximumPlotPoints = 32;
+		static const size_t kMaximumTableResolution = 256;
+		static const size_t kDefaultTableResolution = 128;
+
+		///
+		/// @details Returns the curve of a 1999 Mazda MX-5 1.9, which is built and normalized at compile time.
+		///
+		static const TorqueCurve& MiataTorqueCurve(void);
+
+		constexpr TorqueCurve(void);
+
+		///
+		/// @details Adds each of the plot points and normalizes the curve, when declared constexpr this happens entirely
+		///   at compile time.
+		///
+		/// @param plotPoints Each point as { engineSpeedRPM, torque } following the rules of AddPlotPoint().
+		/// @param tableResolution See NormalizeTorqueCurve().
+		///
+		constexpr TorqueCurve(std::initializer_list<PlotPoint> plotPoints, const size_t tableResolution = kDefaultTableResolution);
 
 		///
 		/// @details Inserts a point for the curve to follow a more realistic torque/power curve of an internal combustion engine.
@@ -51,19 +79,25 @@ namespace Racecar
 		/// @param engineSpeedRPM Must be a positive value representing the speed of the engine in revolutions-per-minute.
 		/// @param torque Must be a positive value representing the torque produced at engineSpeedRPM.
 		///
-		/// @note Cannot be called once the TorqueCurve object has been normalized or an error condition will be triggered.
+		/// @note Cannot be called once the TorqueCurve object has been normalized or an error condition will be triggered,
+		///   and no more than kMaximumPlotPoints can be added.
 		///
-		void AddPlotPoint(const Real engineSpeedRPM, const Real torque);
+		constexpr void AddPlotPoint(const Real engineSpeedRPM, const Real torque);
 
 		///
-		/// @details Finds the maximum torque value in the table and normalizes all values to be within 0.0 to 1.0.
+		/// @details Finds the maximum torque value in the table and normalizes all values to be within 0.0 to 1.0, then
+		///   resamples the plotted points into a uniformly spaced lookup table so each lookup is an index computation
+		///   and a single lerp regardless of the number of plotted points.
 		///
-		void NormalizeTorqueCurve(void);
+		/// @param tableResolution The number of uniformly spaced samples between the lowest and highest plotted engine
+		///   speeds, must be from 2 to kMaximumTableResolution. More samples follow the plotted points more closely.
+		///
+		constexpr void NormalizeTorqueCurve(const size_t tableResolution = kDefaultTableResolution);
 
 		///
 		/// @details Will return true if the TorqueTable has been normalized, "set in stone."
 		///
-		inline bool IsNormalized(void) const { return mIsNormalized; }
+		inline constexpr bool IsNormalized(void) const { return mIsNormalized; }
 
 		///
 		/// @details Returns the maximum amount of torque in Nm (Newton-meters) of the engine.
@@ -75,29 +109,202 @@ namespace Racecar
 		///
 		Real GetOutputTorque(const Real engineSpeedRPM) const;
 
+		///
+		/// @details Computes the maximum torque output in Nm (Newton-meters) for each of the engine speeds given, this is
+		///   identical to calling GetOutputTorque() for each value but written to be vectorized by the compiler.
+		///
+		/// @param engineSpeedsRPM An array of count engine speeds in revolutions-per-minute.
+		/// @param outputTorques An array of count values that will be filled with the torque at each engine speed, which
+		///   must not overlap the engine speeds.
+		///
+		void GetOutputTorques(const Real* engineSpeedsRPM, Real* __restrict outputTorques, const size_t count) const;
+
 		Real GetMaximumRPM(void) const;
+		Real GetMinimumRPM(void) const;
+
+		///
+		/// @details Returns the number of samples in the lookup table built by NormalizeTorqueCurve().
+		///
+		inline constexpr size_t GetTableResolution(void) const { return mTableResolution; }
 
 	private:
 
 		///
 		/// @details Returns a value from 0 to 1 representing a percentage of the maximum torque at this given engine speed.
+		///   Engine speeds outside of the plotted range are clamped to the first or last plotted point.
 		///
 		Real GetOutputValue(const Real engineSpeedRPM) const;
 
-		static const size_t kTorqueTableSize = 16;
-
-		typedef std::pair<Real, Real> PlotPoint; //RPM, NormalizedTorque
-		std::vector<PlotPoint> mTorqueTable;
+		std::array<PlotPoint, kMaximumPlotPoints> mTorqueTable;
+		std::array<Real, kMaximumTableResolution> mLookupTable;   //Normalized torque sampled uniformly from mMinimumRPM to mMaximumRPM.
+		size_t mNumberOfPlotPoints;
+		size_t mTableResolution;
+		Real mMinimumRPM;
+		Real mMaximumRPM;
+		Real mSamplesPerRPM;              //Converts an offset from mMinimumRPM into a position in mLookupTable.
 		Real mMaximumTorque;  //In Nm
 		bool mIsNormalized;
 	};
 
+//--------------------------------------------------------------------------------------------------------------------//
+
+	///
+	/// @details Describes the torque of an engine across both engine speed and throttle position, since the torque an
+	///   engine produces at part throttle is not a simple percentage of the full throttle torque. Each throttle position
+	///   is described by a TorqueCurve and the map is resampled into a uniform grid so a lookup is a bilinear
+	///   interpolation of four neighboring samples.
+	///
+	class TorqueMap
+	{
+	public:
+		///
+		/// @details Creates a map where the torque scales linearly with throttle position, which is the behavior of an
+		///   Engine that was built directly from a TorqueCurve.
+		///
+		static TorqueMap FromTorqueCurve(const TorqueCurve& fullThrottleCurve);
+
+		TorqueMap(void);
+		~TorqueMap(void);
+
+		///
+		/// @details Adds the torque the engine produces at a given throttle position. If no curve is added at a throttle
+		///   position of 0.0 the engine is assumed to produce no torque with the throttle closed.
+		///
+		/// @param throttlePosition Must be within 0.0 to 1.0 and not already have a curve added.
+		/// @param torqueCurve Must be normalized, the torque produced at each engine speed for this throttle position.
+		///
+		/// @note Cannot be called once the TorqueMap object has been normalized or an error condition will be triggered.
+		///
+		void AddThrottleCurve(const Real throttlePosition, const TorqueCurve& torqueCurve);
+
+		///
+		/// @details Resamples each of the throttle curves into a grid with uniformly spaced engine speeds and throttle
+		///   positions. A curve must have been added for the full throttle position of 1.0.
+		///
+		/// @param engineSpeedResolution The number of samples across the engine speeds, must be at least 2.
+		/// @param throttleResolution The number of samples from 0.0 to 1.0 throttle, must be at least 2.
+		///
+		void NormalizeTorqueMap(const size_t engineSpeedResolution = TorqueCurve::kDefaultTableResolution,
+			const size_t throttleResolution = kDefaultThrottleResolution);
+
+		///
+		/// @details Will return true if the TorqueMap has been normalized, "set in stone."
+		///
+		inline bool IsNormalized(void) const { return mIsNormalized; }
+
+		///
+		/// @details Returns the torque output of the engine in Nm (Newton-meters) at the given engine speed and throttle
+		///   position. Values outside of the mapped range are clamped to the edges of the map.
+		///
+		Real GetOutputTorque(const Real engineSpeedRPM, const Real throttlePosition) const;
+
+		///
+		/// @details Returns the torque output as above, and the slope of the torque in Nm per rpm across the cell of the
+		///   map the engine speed is within, which is zero beyond the mapped range.
+		///
+		Real GetOutputTorque(const Real engineSpeedRPM, const Real throttlePosition, Real& torqueSlope) const;
+
+		///
+		/// @details Returns the maximum amount of torque in Nm (Newton-meters) at full throttle.
+		///
+		Real GetMaximumTorque(void) const;
+		Real GetMaximumRPM(void) const;
+
+		///
+		/// @details Returns the curve that was added for the full throttle position.
+		///
+		const TorqueCurve& GetFullThrottleCurve(void) const;
+
+		static const size_t kDefaultThrottleResolution = 11;
+
+	private:
+		Real ComputeTorqueFromCurves(const Real engineSpeedRPM, const Real throttlePosition) const;
+
+		typedef std::pair<Real, TorqueCurve> ThrottleCurve; //ThrottlePosition, TorqueCurve
+		std::vector<ThrottleCurve> mThrottleCurves;         //Only kept until the map is normalized.
+		TorqueCurve mFullThrottleCurve;
+		std::vector<Real> mTorqueTable;                     //In Nm, each throttle sample is a row of engine speed samples.
+		size_t mEngineSpeedResolution;
+		size_t mThrottleResolution;
+		Real mMinimumRPM;
+		Real mMaximumRPM;
+		Real mSamplesPerRPM;
+		bool mIsNormalized;
+	};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+	///
+	/// @details The description of an Engine that does not change while simulating, a single specification can be
+	///   shared by every engine of the same model so each engine only holds its own speed and throttle position.
+	///
+	struct EngineSpecification : public RotatingBodySpecification
+	{
+		explicit EngineSpecification(const Real& momentOfInertia, const TorqueMap& torqueMap);
+
+		TorqueMap mTorqueMap;
+		Real mFrictionResistance;   //See Engine::SetEngineFrictionResistance(), defaults to 0.0.
+		Real mMinimumEngineSpeed;   //See Engine::SetMinimumEngineSpeed(), defaults to -1.0.
+		Real mMaximumEngineSpeed;   //See Engine::SetMaximumEngineSpeed(), defaults to -1.0.
+		bool mConstantPower;        //See Engine::SetConstantPower(), defaults to true.
+
+		///
+		/// @details Keeps the engine speed at the end of a step between the minimum and maximum engine speeds. The rev
+		///   limiter can only cut the engine torque, so the speed is held no lower than the speed without engine torque,
+		///   and the idle governor can only open the throttle, so the speed is held no higher than at full throttle.
+		///
+		/// @note The speeds without torque and at full throttle are only computed when a limit has been reached.
+		///
+		/// @note The limit is only solved against the engine impulse, not as a bound in the coupled clutch and gear
+		///   joint impulses that follow, so when the clutch is locked the load can still carry the engine past the
+		///   rev limiter (or below idle) for the step, for instance with the wheels driving the engine downhill.
+		///
+		template<typename NoTorqueSpeed, typename FullThrottleSpeed> Real LimitEngineSpeed(const Real& engineSpeed,
+			const NoTorqueSpeed& computeNoTorqueSpeed, const FullThrottleSpeed& computeFullThrottleSpeed) const
+		{
+			if (mMaximumEngineSpeed >= 0.0 && engineSpeed > mMaximumEngineSpeed)
+			{
+				const Real noTorqueSpeed(computeNoTorqueSpeed());
+				return (noTorqueSpeed > mMaximumEngineSpeed) ? noTorqueSpeed : mMaximumEngineSpeed;
+			}
+
+			if (mMinimumEngineSpeed > 0.0 && engineSpeed < mMinimumEngineSpeed)
+			{
+				const Real fullThrottleSpeed(computeFullThrottleSpeed());
+				return (fullThrottleSpeed < mMinimumEngineSpeed) ? fullThrottleSpeed : mMinimumEngineSpeed;
+			}
+
+			return engineSpeed;
+		}
+	};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+	///
+	/// @details How the Engine steps its own speed forward each time it is simulated.
+	///
+	enum class EngineIntegration
+	{
+		Explicit,               //Applies the torque and friction impulses found at the start of the step, the default.
+		AnalyticWhenDecoupled,  //Takes an exact exponential step whenever no load is connected downstream of the engine.
+	};
+
 //--------------------------------------------------------------------------------------------------------------------//
 
 	class Engine : public RotatingBody
 	{
 	public:
 		explicit Engine(const Real& momentOfInertia, const TorqueCurve& torqueCurve);
+
+		///
+		/// @details Creates an engine that produces torque from both the engine speed and throttle position.
+		///
+		explicit Engine(const Real& momentOfInertia, const TorqueMap& torqueMap);
+
+		///
+		/// @details Creates an engine that shares the specification with any other engines created from it.
+		///
+		explicit Engine(const std::shared_ptr<const EngineSpecification>& specification);
 		virtual ~Engine(void);
 
 		///
@@ -111,22 +318,21 @@ namespace Racecar
 		void SetEngineFrictionResistance(const Real& resistance);
 
 		///
-		/// @details Sets the minimum speed the engine will try forcing itself to. This creates a FICTIONAL force and is
-		///   NOT SIMULATION QUALITY. This would prevent the engine from stalling below some point in rpm range.
+		/// @details Sets the minimum speed the engine will try holding itself at, like an idle governor that opens the
+		///   throttle as far as needed. This prevents the engine from stalling unless it is loaded beyond full throttle.
 		///
-		/// @param speedRadiansPerSecond The speed at which the engine will begin applying this fictional force if the
-		///   engine speed is below. Radians / Second.
+		/// @param speedRadiansPerSecond The speed at which the idle governor holds the engine if the engine speed would
+		///   otherwise fall below. Radians / Second.
 		///
-		/// @note If this is set to below zero (-1.0) the engine will not perform the fictional force. This is default behavior.
+		/// @note If this is set to below zero (-1.0) the engine will not use an idle governor. This is default behavior.
 		///
 		void SetMinimumEngineSpeed(const Real& speedRadiansPerSecond);
 
 		///
 		/// @details Sets the maximums speed the engine will rotate at before getting an ignition cut, such as red-lining.
-		///   This may not be simulation quality, but prevents the engine from endlessly getting faster.
+		///   The engine torque is cut only as much as needed to hold the engine at this speed, so it does not oscillate.
 		///
-		/// @param speedRadiansPerSecond The speed at which the engine will not apply any acceleration from throttle when
-		///   engine speed is already above. Radians / Second.
+		/// @param speedRadiansPerSecond The speed the engine torque will not accelerate the engine beyond. Radians / Second.
 		///
 		/// @note If this is set to below zero (-1.0) the engine will not perform the throttle-cut. This is default behavior.
 		///
@@ -140,22 +346,151 @@ namespace Racecar
 		void SetConstantPower(const bool constantPower);
 
 		///
-		/// 
+		/// @details While the clutch is disengaged or the transmission is in neutral the engine is only its own inertia,
+		///   driven by the torque map and resisted by the friction resistance. With AnalyticWhenDecoupled the engine
+		///   integrates that exactly, so it remains accurate and stable with fixed time steps of 20ms to 50ms or more.
 		///
-		TorqueCurve GetTorqueCurve(void) const;
+		/// @note This defaults to EngineIntegration::Explicit, and only applies when SetConstantPower() is true.
+		///
+		inline void SetIntegration(const EngineIntegration integration) { mIntegration = integration; }
+		inline EngineIntegration GetIntegration(void) const { return mIntegration; }
+
+		///
+		/// @details Returns the full throttle torque curve of the engine.
+		///
+		const TorqueCurve& GetTorqueCurve(void) const;
+
+		inline const TorqueMap& GetTorqueMap(void) const { return GetSpecificationAs<EngineSpecification>().mTorqueMap; }
+
+		inline std::shared_ptr<const EngineSpecification> GetSpecification(void) const { return GetSharedSpecificationAs<EngineSpecification>(); }
 
 	protected:
 		virtual void OnControllerChange(const Racecar::RacecarControllerInterface& racecarController) override;
 		virtual void OnSimulate(const Real& fixedTime);
 
 	private:
-		const TorqueCurve mTorqueCurve;
-		Real mFrictionResistance;
-		Real mMinimumEngineSpeed;
-		Real mMaximumEngineSpeed;
+		///
+		/// @details Returns the engine speed after the time step when no load is connected downstream, by linearizing the
+		///   torque map around the current engine speed and solving  I * dw/dt = T + T' * (w - w0) - c * w  exactly, where
+		///   the inertia includes anything turning rigidly with the engine, such as an engaged clutch in neutral.
+		///
+		Real ComputeDecoupledAngularVelocity(const Real& fixedTime, const Real& totalInertia, const float throttlePosition,
+			const bool isProducingTorque) const;
+
 		float mThrottlePosition;
-		bool mConstantPower;
+		EngineIntegration mIntegration;
 	};
 };	/* namespace Racecar */
 
+//--------------------------------------------------------------------------------------------------------------------//
+
+constexpr Racecar::TorqueCurve::TorqueCurve(void) :
+	mTorqueTable{},
+	mLookupTable{},
+	mNumberOfPlotPoints(0),
+	mTableResolution(0),
+	mMinimumRPM(0.0),
+	mMaximumRPM(0.0),
+	mSamplesPerRPM(0.0),
+	mMaximumTorque(0.0),
+	mIsNormalized(false)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+constexpr Racecar::TorqueCurve::TorqueCurve(std::initializer_list<PlotPoint> plotPoints, const size_t tableResolution) :
+	TorqueCurve()
+{
+	for (const PlotPoint& plotPoint : plotPoints)
+	{
+		AddPlotPoint(plotPoint.mEngineSpeedRPM, plotPoint.mTorque);
+	}
+
+	NormalizeTorqueCurve(tableResolution);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+constexpr void Racecar::TorqueCurve::AddPlotPoint(const Racecar::Real engineSpeedRPM, const Racecar::Real torque)
+{
+	error_if(true == mIsNormalized, "Cannot add more plot points to a table that is already normalized.");
+	error_if(engineSpeedRPM < 0.0, "Cannot add plot point for engine speeds less than zero.");
+	error_if(torque < 0.0, "Cannot add plot point for torque amounts that are less than zero.");
+	error_if(mNumberOfPlotPoints >= kMaximumPlotPoints, "Cannot add more than kMaximumPlotPoints to a table.");
+
+	for (size_t plotIndex(0); plotIndex < mNumberOfPlotPoints; ++plotIndex)
+	{
+		const Real difference(mTorqueTable[plotIndex].mEngineSpeedRPM - engineSpeedRPM);
+		error_if(difference < 0.1 && difference > -0.1, "Cannot plot a point on top of another point!");
+	}
+
+	//Keep the plotted points sorted by engine speed as they are inserted, this is a plain insertion sort since the
+	//standard algorithms can not be used at compile time.
+	size_t insertIndex(mNumberOfPlotPoints);
+	while (insertIndex > 0 && mTorqueTable[insertIndex - 1].mEngineSpeedRPM > engineSpeedRPM)
+	{
+		mTorqueTable[insertIndex] = mTorqueTable[insertIndex - 1];
+		--insertIndex;
+	}
+
+	mTorqueTable[insertIndex] = PlotPoint{ engineSpeedRPM, torque };
+	++mNumberOfPlotPoints;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+constexpr void Racecar::TorqueCurve::NormalizeTorqueCurve(const size_t tableResolution)
+{
+	error_if(0 == mNumberOfPlotPoints, "Cannot normalize a table without plotted points. Call AddPlotPoint() to make it interesting.");
+	error_if(tableResolution < 2 || tableResolution > kMaximumTableResolution, "Cannot normalize a table with a resolution outside of 2 to kMaximumTableResolution samples.");
+	error_if(true == mIsNormalized, "Cannot normalize a table that is already normalized.");
+
+	mMaximumTorque = 0.0;
+	for (size_t plotIndex(0); plotIndex < mNumberOfPlotPoints; ++plotIndex)
+	{
+		mMaximumTorque = (mTorqueTable[plotIndex].mTorque > mMaximumTorque) ? mTorqueTable[plotIndex].mTorque : mMaximumTorque;
+	}
+
+	error_if(mMaximumTorque <= 0.0, "Cannot normalize a table that never produces any torque.");
+	for (size_t plotIndex(0); plotIndex < mNumberOfPlotPoints; ++plotIndex)
+	{
+		mTorqueTable[plotIndex].mTorque /= mMaximumTorque;
+	}
+
+	mMinimumRPM = mTorqueTable[0].mEngineSpeedRPM;
+	mMaximumRPM = mTorqueTable[mNumberOfPlotPoints - 1].mEngineSpeedRPM;
+	mTableResolution = tableResolution;
+	const Real rpmPerSample((mMaximumRPM - mMinimumRPM) / static_cast<Real>(tableResolution - 1));
+	mSamplesPerRPM = (rpmPerSample > kEpsilon) ? 1.0 / rpmPerSample : 0.0;
+
+	//Walk the sorted plot points once while stepping through the uniformly spaced samples, each sample is a linear
+	//interpolation between the two plotted points surrounding it.
+	size_t plotIndex(0);
+	for (size_t sampleIndex(0); sampleIndex < tableResolution; ++sampleIndex)
+	{
+		if (1 == mNumberOfPlotPoints)
+		{
+			mLookupTable[sampleIndex] = mTorqueTable[0].mTorque;
+			continue;
+		}
+
+		const Real sampleRPM(mMinimumRPM + rpmPerSample * static_cast<Real>(sampleIndex));
+		while (plotIndex + 2 < mNumberOfPlotPoints && sampleRPM > mTorqueTable[plotIndex + 1].mEngineSpeedRPM)
+		{
+			++plotIndex;
+		}
+
+		const PlotPoint& previousPoint(mTorqueTable[plotIndex]);
+		const PlotPoint& currentPoint(mTorqueTable[plotIndex + 1]);
+		const Real percentage((sampleRPM - previousPoint.mEngineSpeedRPM) / (currentPoint.mEngineSpeedRPM - previousPoint.mEngineSpeedRPM));
+		const Real clampedPercentage((percentage < 0.0) ? 0.0 : (percentage > 1.0) ? 1.0 : percentage);
+		mLookupTable[sampleIndex] = previousPoint.mTorque + (currentPoint.mTorque - previousPoint.mTorque) * clampedPercentage;
+	}
+
+	mIsNormalized = true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 #endif /* _Racecar_Engine_h_ */
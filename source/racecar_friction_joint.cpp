@@ -0,0 +1,36 @@
+///
+/// @file
+/// @details A joint that uses friction to bring two speeds together, with static and kinetic friction, used by the
+///   clutch, synchromesh and brakes.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#include "racecar_friction_joint.h"
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::FrictionJoint::FrictionJoint(void) :
+	mNormalForce(0.0),
+	mSlipTime(0.0),
+	mIsLocked(false)
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::FrictionJoint::~FrictionJoint(void)
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::FrictionJoint::ComputeFrictionImpulse(const Real& matchingImpulse, const Real& staticFrictionCoefficient,
+	const Real& kineticFrictionCoefficient, const Real& fixedTimeStep)
+{
+	return Racecar::ComputeFrictionImpulse(matchingImpulse, mNormalForce, staticFrictionCoefficient, kineticFrictionCoefficient,
+		fixedTimeStep, mIsLocked, mSlipTime);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
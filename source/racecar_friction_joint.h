@@ -0,0 +1,93 @@
+///
+/// @file
+/// @details A joint that uses friction to bring two speeds together, with static and kinetic friction, used by the
+///   clutch, synchromesh and brakes.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#ifndef _Racecar_FrictionJoint_h_
+#define _Racecar_FrictionJoint_h_
+
+#include "racecar.h"
+
+namespace Racecar
+{
+
+	///
+	/// @details Computes the impulse friction applies during a time step to bring a joint towards matching speeds. While
+	///   slipping, kinetic friction changes the slip velocity linearly so the time within the step the speeds match is
+	///   found exactly, at which point the joint locks and static friction holds it until the load overcomes it.
+	///
+	/// @param matchingImpulse The impulse that would bring the speeds of the joint together during this step.
+	/// @param normalForce The force pressing the friction surfaces together, scaled by the effective radius so that
+	///   the normal force multiplied by a friction coefficient is a torque in Nm.
+	/// @param isLocked Should be true if the joint was locked at the start of the step, and is set to true if the joint
+	///   is locked at the end of the step.
+	/// @param slipTime Is set to the time in seconds the joint was slipping during the step.
+	///
+	/// @note This is the kernel used by the FrictionJoint, and by the brakes of the reduced Drivetrain directly.
+	///
+	inline Real ComputeFrictionImpulse(const Real& matchingImpulse, const Real& normalForce, const Real& staticFrictionCoefficient,
+		const Real& kineticFrictionCoefficient, const Real& fixedTimeStep, bool& isLocked, Real& slipTime)
+	{
+		//Kinetic friction matches the speeds at  t = |Jmatch| / (uk * N)  and if that is within the step the joint locks
+		//there, held for the remainder of the step with static friction which can always hold the remaining load since
+		//|Jmatch| <= uk * N * t + us * N * (dt - t).  A locked joint holds while  |Jmatch| <= us * N * dt.
+		const Real kineticFrictionTorque(normalForce * kineticFrictionCoefficient);
+		const Real frictionCoefficient((true == isLocked) ? staticFrictionCoefficient : kineticFrictionCoefficient);
+		const Real matchingMagnitude(fabs(matchingImpulse));
+		const bool isHolding(matchingMagnitude <= frictionCoefficient * normalForce * fixedTimeStep);
+
+		slipTime = (false == isHolding) ? fixedTimeStep :
+			(true == isLocked || kineticFrictionTorque <= 0.0) ? 0.0 : matchingMagnitude / kineticFrictionTorque;
+		isLocked = isHolding;
+		return (true == isHolding) ? matchingImpulse : kineticFrictionTorque * fixedTimeStep * Racecar::Sign(matchingImpulse);
+	}
+
+	///
+	/// @details Holds the state of a friction joint between steps, the friction coefficients are not part of the joint
+	///   but given with each step by the component, usually from its specification.
+	///
+	class FrictionJoint
+	{
+	public:
+		FrictionJoint(void);
+		~FrictionJoint(void);
+
+		inline void SetNormalForce(const Real& normalForce) { mNormalForce = normalForce; }
+		inline const Real& GetNormalForce(void) const { return mNormalForce; }
+
+		///
+		/// @details Computes the impulse friction applies during the time step given the impulse that would match the
+		///   speeds of the joint, see Racecar::ComputeFrictionImpulse().
+		///
+		Real ComputeFrictionImpulse(const Real& matchingImpulse, const Real& staticFrictionCoefficient,
+			const Real& kineticFrictionCoefficient, const Real& fixedTimeStep = Racecar::kFixedTimeStep);
+
+		///
+		/// @details True once the speeds of the joint have matched and are held together by static friction.
+		///
+		inline bool IsLocked(void) const { return mIsLocked; }
+
+		///
+		/// @details Releases the joint so it must match speeds again before locking, such as when a clutch disengages.
+		///
+		inline void Unlock(void) { mIsLocked = false; }
+
+		///
+		/// @details Returns the time in seconds the joint was slipping during the last step, which is the entire step if
+		///   it did not lock, the time into the step the speeds matched if it locked, or zero if it remained locked.
+		///
+		inline const Real& GetSlipTime(void) const { return mSlipTime; }
+
+	private:
+		Real mNormalForce; //N
+		Real mSlipTime;    //seconds
+		bool mIsLocked;
+	};
+
+};	/* namespace Racecar */
+
+#endif /* _Racecar_FrictionJoint_h_ */
@@ -0,0 +1,303 @@
+///
+/// @file
+/// @details Searches for the gear ratios and final drive of a drive-train that best meet a performance target by
+///   simulating a launch for many candidates in parallel.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#include "racecar_gear_optimizer.h"
+#include "racecar_controller.h"
+#include "racecar_shift_scheduler.h"
+#include "racecar_random.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <thread>
+
+namespace
+{
+	const Racecar::Real kHundredKilometersPerHour(100.0 / 3.6);  //meters / second
+	const Racecar::Real kTopSpeedTolerance(1.0e-6);              //meters / second gained in a step once at top speed.
+
+	///
+	/// @details Owns a drive-train and the specifications it was built from so each candidate only rewrites the ratios
+	///   in place and resets the drive-train, nothing is allocated between candidates.
+	///
+	class LaunchSimulator
+	{
+	public:
+		LaunchSimulator(const Racecar::DrivetrainSpecification& vehicle, const Racecar::GearOptimizerSettings& settings) :
+			mSettings(settings),
+			mTransmission(std::make_shared<Racecar::TransmissionSpecification>(vehicle.mTransmission->mMomentOfInertia,
+				std::vector<Racecar::Real>(settings.mGearRatioBounds.size(), 1.0), ReverseRatio(*vehicle.mTransmission))),
+			mDifferential(std::make_shared<Racecar::DifferentialSpecification>(*vehicle.mDifferential)),
+			mSpecification(std::make_shared<Racecar::DrivetrainSpecification>(vehicle.mEngine, vehicle.mClutch, mTransmission,
+				mDifferential, vehicle.mWheel, vehicle.mBodyMass)),
+			mDrivetrain(mSpecification, Racecar::DrivetrainFidelity::Reduced),
+			mShiftMap(*mTransmission, 1.0, 1.0, 0.0),
+			mController(),
+			mShiftEngineSpeed(settings.mShiftEngineSpeed)
+		{
+			mTransmission->mIsSynchromeshBox = vehicle.mTransmission->mIsSynchromeshBox;
+
+			if (mShiftEngineSpeed <= 0.0)
+			{
+				const Racecar::EngineSpecification& engine(*vehicle.mEngine);
+				const Racecar::Real maximumEngineSpeed((engine.mMaximumEngineSpeed >= 0.0) ? engine.mMaximumEngineSpeed :
+					Racecar::RevolutionsMinuteToRadiansSecond(engine.mTorqueMap.GetMaximumRPM()));
+				mShiftEngineSpeed = 0.95 * maximumEngineSpeed;
+			}
+
+			mController.SetThrottlePosition(1.0f);
+			mController.SetClutchPosition(0.0f);
+		}
+
+		void Simulate(Racecar::GearRatioCandidate& candidate)
+		{
+			for (size_t gearIndex(0); gearIndex < candidate.mGearRatios.size(); ++gearIndex)
+			{
+				mTransmission->SetGearRatio(static_cast<Racecar::Gear>(gearIndex + 1), candidate.mGearRatios[gearIndex]);
+			}
+
+			mDifferential->mFinalDriveJoint = Racecar::GearJoint(candidate.mFinalDriveRatio);
+			mSpecification->ComputeTables();
+			mShiftMap = Racecar::ShiftMap(*mTransmission, mShiftEngineSpeed, mShiftEngineSpeed, 0.0);
+
+			Racecar::Transmission& transmission(mDrivetrain.GetTransmission());
+			const Racecar::Gear topGear(static_cast<Racecar::Gear>(candidate.mGearRatios.size()));
+			mDrivetrain.Reset();
+			mDrivetrain.ControllerChange(mController);
+			transmission.SelectGear(Racecar::Gear::First);
+
+			const Racecar::Real fixedTime(mSettings.mFixedTimeStep);
+			const size_t numberOfSteps(static_cast<size_t>(mSettings.mMaximumTime / fixedTime));
+			Racecar::Real distance(0.0);
+			Racecar::Real previousSpeed(0.0);
+			candidate.mZeroToHundredTime = std::numeric_limits<Racecar::Real>::max();
+			candidate.mDistanceTime = std::numeric_limits<Racecar::Real>::max();
+			candidate.mTopSpeed = 0.0;
+
+			for (size_t step(1); step <= numberOfSteps; ++step)
+			{
+				const Racecar::Gear selectedGear(transmission.GetSelectedGear());
+				const Racecar::Gear nextGear(mShiftMap.ComputeGear(selectedGear, 1.0f, transmission.GetAngularVelocity()));
+				if (nextGear != selectedGear)
+				{
+					transmission.SelectGear(nextGear);
+				}
+
+				mDrivetrain.Simulate(fixedTime);
+
+				//Crossing times are interpolated within the step so the score does not jump between time steps.
+				const Racecar::Real time(step * fixedTime);
+				const Racecar::Real speed(mDrivetrain.GetLinearVelocity());
+				const Racecar::Real previousDistance(distance);
+				distance += (previousSpeed + speed) * 0.5 * fixedTime;
+
+				if (candidate.mZeroToHundredTime > time && speed >= kHundredKilometersPerHour)
+				{
+					candidate.mZeroToHundredTime = time - fixedTime * (speed - kHundredKilometersPerHour) / (speed - previousSpeed);
+				}
+
+				if (candidate.mDistanceTime > time && distance >= mSettings.mTargetDistance)
+				{
+					candidate.mDistanceTime = time - fixedTime * (distance - mSettings.mTargetDistance) / (distance - previousDistance);
+				}
+
+				candidate.mTopSpeed = std::max(candidate.mTopSpeed, speed);
+
+				const bool isAtTopSpeed(topGear == transmission.GetSelectedGear() && speed - previousSpeed < kTopSpeedTolerance);
+				previousSpeed = speed;
+				if (true == isAtTopSpeed && candidate.mZeroToHundredTime <= time && candidate.mDistanceTime <= time)
+				{
+					break;
+				}
+			}
+
+			candidate.mScore =
+				(Racecar::GearOptimizerTarget::ZeroToHundred == mSettings.mTarget) ? candidate.mZeroToHundredTime :
+				(Racecar::GearOptimizerTarget::TimeToDistance == mSettings.mTarget) ? candidate.mDistanceTime : -candidate.mTopSpeed;
+		}
+
+	private:
+		static Racecar::Real ReverseRatio(const Racecar::TransmissionSpecification& transmission)
+		{
+			return (true == transmission.HasReverseGear()) ? transmission.GetGearJoint(Racecar::Gear::Reverse).GetGearRatio() : 0.0;
+		}
+
+		const Racecar::GearOptimizerSettings& mSettings;
+		std::shared_ptr<Racecar::TransmissionSpecification> mTransmission;
+		std::shared_ptr<Racecar::DifferentialSpecification> mDifferential;
+		std::shared_ptr<Racecar::DrivetrainSpecification> mSpecification;
+		Racecar::Drivetrain mDrivetrain;
+		Racecar::ShiftMap mShiftMap;
+		Racecar::ProgrammaticController mController;
+		Racecar::Real mShiftEngineSpeed;
+	};
+
+	///
+	/// @details Draws the ratios of a candidate, each forward gear is kept no higher than the gear below it.
+	///
+	void DrawCandidate(const Racecar::GearOptimizerSettings& settings, const size_t candidateIndex, Racecar::GearRatioCandidate& candidate)
+	{
+		const size_t numberOfGears(settings.mGearRatioBounds.size());
+		const uint64_t firstCounter(static_cast<uint64_t>(candidateIndex) * (numberOfGears + 1));
+
+		Racecar::DrawGearRatios(settings.mGearRatioBounds, settings.mSeed, firstCounter, candidate.mGearRatios);
+		candidate.mFinalDriveRatio = Racecar::RandomReal(settings.mSeed, firstCounter + numberOfGears,
+			settings.mFinalDriveBounds.mMinimumRatio, settings.mFinalDriveBounds.mMaximumRatio);
+	}
+};
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::GearRatioBounds::GearRatioBounds(const Real& minimumRatio, const Real& maximumRatio) :
+	mMinimumRatio(minimumRatio),
+	mMaximumRatio(maximumRatio)
+{
+	error_if(mMinimumRatio < 0.01, "Expected a minimum ratio above zero.");
+	error_if(mMaximumRatio < mMinimumRatio, "Expected the maximum ratio to be at least the minimum ratio.");
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::HasDescendingMinimumRatios(const std::vector<GearRatioBounds>& gearRatioBounds)
+{
+	for (size_t gearIndex(1); gearIndex < gearRatioBounds.size(); ++gearIndex)
+	{
+		if (gearRatioBounds[gearIndex].mMinimumRatio > gearRatioBounds[gearIndex - 1].mMinimumRatio)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::DrawGearRatios(const std::vector<GearRatioBounds>& gearRatioBounds, const uint64_t seed, const uint64_t firstCounter,
+	std::vector<Real>& gearRatios)
+{
+	//Each drawn ratio is at least the minimum of its gear, which is at least the minimum of the next gear, so the
+	//range of the next gear is never empty.
+	Real previousRatio(std::numeric_limits<Real>::max());
+	for (size_t gearIndex(0); gearIndex < gearRatioBounds.size(); ++gearIndex)
+	{
+		const GearRatioBounds& bounds(gearRatioBounds[gearIndex]);
+		gearRatios[gearIndex] = RandomReal(seed, firstCounter + gearIndex, bounds.mMinimumRatio, std::min(bounds.mMaximumRatio, previousRatio));
+		previousRatio = gearRatios[gearIndex];
+	}
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::GearOptimizerSettings::GearOptimizerSettings(const GearOptimizerTarget target, const std::vector<GearRatioBounds>& gearRatioBounds,
+	const GearRatioBounds& finalDriveBounds) :
+	mTarget(target),
+	mGearRatioBounds(gearRatioBounds),
+	mFinalDriveBounds(finalDriveBounds),
+	mTargetDistance(402.336),
+	mShiftEngineSpeed(-1.0),
+	mMaximumTime(60.0),
+	mFixedTimeStep(Racecar::kFixedTimeStep),
+	mNumberOfCandidates(1000),
+	mNumberOfThreads(0),
+	mSeed(0)
+{
+	error_if(true == mGearRatioBounds.empty(), "Expected bounds for at least one forward gear.");
+	error_if(mGearRatioBounds.size() > TransmissionSpecification::kMaximumForwardGears, "Too many forward gears for Racecar::Gear.");
+	error_if(false == HasDescendingMinimumRatios(mGearRatioBounds), "Expected the minimum ratio of each gear to be no higher than the gear below.");
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::GearRatioOptimizer::GearRatioOptimizer(const std::shared_ptr<const DrivetrainSpecification>& vehicle,
+	const GearOptimizerSettings& settings) :
+	mVehicle(vehicle),
+	mSettings(settings)
+{
+	error_if(nullptr == mVehicle, "GearRatioOptimizer expects a vehicle specification.");
+	error_if(mSettings.mNumberOfCandidates == 0, "Expected at least one candidate.");
+	error_if(mSettings.mMaximumTime <= 0.0 || mSettings.mFixedTimeStep <= 0.0, "Expected a positive simulation time and time step.");
+	error_if(mSettings.mTargetDistance <= 0.0, "Expected a positive target distance.");
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::GearRatioOptimizer::~GearRatioOptimizer(void)
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::GearOptimizerResult Racecar::GearRatioOptimizer::Optimize(void) const
+{
+	const size_t numberOfCandidates(mSettings.mNumberOfCandidates);
+	const size_t numberOfThreads(std::min(numberOfCandidates, (mSettings.mNumberOfThreads > 0) ? mSettings.mNumberOfThreads :
+		std::max(static_cast<size_t>(std::thread::hardware_concurrency()), size_t(1))));
+
+	//Everything the threads write to is sized up front, each candidate is written by exactly one thread.
+	std::vector<GearRatioCandidate> candidates(numberOfCandidates);
+	for (GearRatioCandidate& candidate : candidates)
+	{
+		candidate.mGearRatios.resize(mSettings.mGearRatioBounds.size());
+	}
+
+	std::atomic<size_t> nextCandidate(0);
+	const auto simulateCandidates = [&]() {
+		LaunchSimulator launchSimulator(*mVehicle, mSettings);
+		for (size_t candidateIndex(nextCandidate++); candidateIndex < numberOfCandidates; candidateIndex = nextCandidate++)
+		{
+			DrawCandidate(mSettings, candidateIndex, candidates[candidateIndex]);
+			launchSimulator.Simulate(candidates[candidateIndex]);
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (size_t threadIndex(1); threadIndex < numberOfThreads; ++threadIndex)
+	{
+		threads.emplace_back(simulateCandidates);
+	}
+
+	simulateCandidates();
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	GearOptimizerResult result;
+	result.mBest = *std::min_element(candidates.begin(), candidates.end(),
+		[](const GearRatioCandidate& a, const GearRatioCandidate& b) { return a.mScore < b.mScore; });
+
+	const bool isTargetTime(GearOptimizerTarget::TopSpeed != mSettings.mTarget);
+	const auto launchTime = [isTargetTime](const GearRatioCandidate& candidate) {
+		return (true == isTargetTime) ? candidate.mScore : candidate.mZeroToHundredTime;
+	};
+
+	//Sorted by launch time, each candidate is on the front only if it is faster than every quicker launching candidate.
+	std::sort(candidates.begin(), candidates.end(), [&launchTime](const GearRatioCandidate& a, const GearRatioCandidate& b) {
+		return (launchTime(a) < launchTime(b)) || (launchTime(a) == launchTime(b) && a.mTopSpeed > b.mTopSpeed);
+	});
+
+	Real bestTopSpeed(-std::numeric_limits<Real>::max());
+	for (const GearRatioCandidate& candidate : candidates)
+	{
+		if (candidate.mTopSpeed > bestTopSpeed)
+		{
+			result.mParetoFront.push_back(candidate);
+			bestTopSpeed = candidate.mTopSpeed;
+		}
+	}
+
+	return result;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
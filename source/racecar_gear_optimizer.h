@@ -0,0 +1,126 @@
+///
+/// @file
+/// @details Searches for the gear ratios and final drive of a drive-train that best meet a performance target by
+///   simulating a launch for many candidates in parallel.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#ifndef _Racecar_GearOptimizer_h_
+#define _Racecar_GearOptimizer_h_
+
+#include "racecar.h"
+#include "racecar_drivetrain.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Racecar
+{
+
+	enum class GearOptimizerTarget
+	{
+		ZeroToHundred,   //Minimize the time from a standstill to 100 km/h.
+		TimeToDistance,  //Minimize the time from a standstill to cover the target distance.
+		TopSpeed,        //Maximize the top speed reached.
+	};
+
+	struct GearRatioBounds
+	{
+		GearRatioBounds(const Real& minimumRatio, const Real& maximumRatio);
+
+		Real mMinimumRatio;
+		Real mMaximumRatio;
+	};
+
+	///
+	/// @details Returns true when the minimum ratio of each forward gear is no higher than the minimum of the gear below
+	///   it, so whatever ratio is drawn for a gear the next gear can always be drawn no higher.
+	///
+	bool HasDescendingMinimumRatios(const std::vector<GearRatioBounds>& gearRatioBounds);
+
+	///
+	/// @details Draws a ratio within the bounds of each forward gear, each kept no higher than the gear below it. The
+	///   ratio of each gear is drawn from the counter firstCounter + gearIndex, see Racecar::RandomReal().
+	///
+	/// @note The bounds are expected to have descending minimum ratios, and gearRatios to hold a ratio for each gear.
+	///
+	void DrawGearRatios(const std::vector<GearRatioBounds>& gearRatioBounds, const uint64_t seed, const uint64_t firstCounter,
+		std::vector<Real>& gearRatios);
+
+	struct GearOptimizerSettings
+	{
+		///
+		/// @param gearRatioBounds The range of ratios to search for each forward gear starting from First, the number of
+		///   bounds is the number of forward gears of each candidate. The minimum ratio of each gear must be no higher
+		///   than the minimum of the gear below it, see HasDescendingMinimumRatios().
+		///
+		explicit GearOptimizerSettings(const GearOptimizerTarget target, const std::vector<GearRatioBounds>& gearRatioBounds,
+			const GearRatioBounds& finalDriveBounds);
+
+		GearOptimizerTarget mTarget;
+		std::vector<GearRatioBounds> mGearRatioBounds;
+		GearRatioBounds mFinalDriveBounds;
+		Real mTargetDistance;      //meters, used by the TimeToDistance target, defaults to 402.336 (quarter mile).
+		Real mShiftEngineSpeed;    //radians / second, defaults to -1.0 for 95% of the maximum engine speed.
+		Real mMaximumTime;         //seconds each launch is simulated for at most, defaults to 60.
+		Real mFixedTimeStep;       //seconds, defaults to Racecar::kFixedTimeStep.
+		size_t mNumberOfCandidates; //defaults to 1000.
+		size_t mNumberOfThreads;    //defaults to 0 for one per hardware thread.
+		uint64_t mSeed;
+	};
+
+	///
+	/// @details The ratios of a candidate and how it performed, a time that was not reached within the maximum time is
+	///   left at std::numeric_limits<Real>::max().
+	///
+	struct GearRatioCandidate
+	{
+		std::vector<Real> mGearRatios;
+		Real mFinalDriveRatio;
+		Real mZeroToHundredTime;  //seconds
+		Real mDistanceTime;       //seconds
+		Real mTopSpeed;           //meters / second
+		Real mScore;              //The time of the target, or the negative top speed, lower is better.
+	};
+
+	struct GearOptimizerResult
+	{
+		GearRatioCandidate mBest;
+
+		///
+		/// @details The candidates that no other candidate beats in both launch time and top speed, sorted from the
+		///   quickest launch to the highest top speed. The launch time is the time of the target, or the time to
+		///   100 km/h when the target is TopSpeed.
+		///
+		std::vector<GearRatioCandidate> mParetoFront;
+	};
+
+	///
+	/// @details Runs a full throttle launch from a standstill, shifting at the shift speed, for each candidate set of
+	///   ratios using the Reduced fidelity of the Drivetrain. Candidates are drawn from the bounds with counter based
+	///   random numbers so the results do not depend on the number of threads. Each thread builds a single drive-train
+	///   and resets it between candidates, rewriting the ratios of its own specifications in place.
+	///
+	class GearRatioOptimizer
+	{
+	public:
+		///
+		/// @param vehicle Provides every component of the racecar being tuned, the transmission only provides the
+		///   inertia, synchromesh and reverse ratio as the forward ratios and final drive come from the candidates.
+		///
+		explicit GearRatioOptimizer(const std::shared_ptr<const DrivetrainSpecification>& vehicle, const GearOptimizerSettings& settings);
+		~GearRatioOptimizer(void);
+
+		GearOptimizerResult Optimize(void) const;
+
+	private:
+		std::shared_ptr<const DrivetrainSpecification> mVehicle;
+		GearOptimizerSettings mSettings;
+	};
+
+};	/* namespace Racecar */
+
+#endif /* _Racecar_GearOptimizer_h_ */
@@ -10,11 +10,27 @@
 #define _Racecar_RacecarKit_h_
 
 #include "racecar.h"
+#include "racecar_controller_channels.h"
+#include "racecar_controller_queue.h"
 #include "racecar_engine.h"
+#include "racecar_friction_joint.h"
 #include "racecar_clutch.h"
 #include "racecar_transmission.h"
+#include "racecar_shift_scheduler.h"
+#include "racecar_shift_points.h"
 #include "racecar_locked_differential.h"
+#include "racecar_open_differential.h"
+#include "racecar_limited_slip_differential.h"
+#include "racecar_tire_model.h"
 #include "racecar_wheel.h"
+#include "racecar_suspension.h"
+#include "racecar_planar_dynamics.h"
+#include "racecar_surface_map.h"
+#include "racecar_track_profile.h"
 #include "racecar_body.h"
+#include "racecar_drivetrain.h"
+#include "racecar_random.h"
+#include "racecar_gear_optimizer.h"
+#include "racecar_lap_simulator.h"
 
 #endif /* _Racecar_RacecarKit_h_ */
@@ -0,0 +1,458 @@
+///
+/// @file
+/// @details Runs many laps of a track in parallel, varying the setup of the racecar and the inputs of the driver, to
+///   find the distribution of lap times a setup can be expected to give.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#include "racecar_lap_simulator.h"
+#include "racecar_controller.h"
+#include "racecar_shift_scheduler.h"
+#include "racecar_random.h"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+	const Racecar::Real kUnlimitedSpeed(1000.0);        //meters / second, the speed of a straight.
+	const Racecar::Real kMinimumCurvature(1.0e-6);      //1 / meters, flatter than this is a straight.
+	const Racecar::Real kShiftHysteresis(0.2);
+	const Racecar::Real kMicrosecondsPerSecond(1.0e6);
+	const uint64_t kDriverNoiseCounter(uint64_t(1) << 32); //Setup draws count up from 0, the driver from here.
+
+	///
+	/// @details Owns a drive-train and the specifications it was built from so each lap only rewrites the setup in
+	///   place and resets the drive-train, nothing is allocated between laps.
+	///
+	class LapDriver
+	{
+	public:
+		LapDriver(const Racecar::DrivetrainSpecification& vehicle, const Racecar::LapSimulatorSettings& settings,
+			const std::vector<Racecar::Real>& cornerSpeeds, const Racecar::Real& sampleSpacing) :
+			mSettings(settings),
+			mCornerSpeeds(cornerSpeeds),
+			mSampleSpacing(sampleSpacing),
+			mSpeedLimits(cornerSpeeds.size()),
+			mClutch(std::make_shared<Racecar::ClutchSpecification>(*vehicle.mClutch)),
+			mTransmission(std::make_shared<Racecar::TransmissionSpecification>(vehicle.mTransmission->mMomentOfInertia,
+				std::vector<Racecar::Real>(settings.mGearRatioBounds.size(), 1.0), ReverseRatio(*vehicle.mTransmission))),
+			mDifferential(std::make_shared<Racecar::DifferentialSpecification>(*vehicle.mDifferential)),
+			mWheel(std::make_shared<Racecar::WheelSpecification>(*vehicle.mWheel)),
+			mSpecification(std::make_shared<Racecar::DrivetrainSpecification>(vehicle.mEngine, mClutch, mTransmission,
+				mDifferential, mWheel, vehicle.mBodyMass)),
+			mDrivetrain(mSpecification, settings.mFidelity),
+			mShiftMap(*mTransmission, 1.0, 1.0, kShiftHysteresis),
+			mController(),
+			mShiftEngineSpeed(settings.mShiftEngineSpeed)
+		{
+			mTransmission->mIsSynchromeshBox = vehicle.mTransmission->mIsSynchromeshBox;
+
+			if (mShiftEngineSpeed <= 0.0)
+			{
+				const Racecar::EngineSpecification& engine(*vehicle.mEngine);
+				const Racecar::Real maximumEngineSpeed((engine.mMaximumEngineSpeed >= 0.0) ? engine.mMaximumEngineSpeed :
+					Racecar::RevolutionsMinuteToRadiansSecond(engine.mTorqueMap.GetMaximumRPM()));
+				mShiftEngineSpeed = 0.95 * maximumEngineSpeed;
+			}
+
+			mController.SetClutchPosition(0.0f);
+		}
+
+		void Simulate(const uint64_t lapSeed, Racecar::LapRecord& lap)
+		{
+			for (size_t gearIndex(0); gearIndex < lap.mGearRatios.size(); ++gearIndex)
+			{
+				mTransmission->SetGearRatio(static_cast<Racecar::Gear>(gearIndex + 1), lap.mGearRatios[gearIndex]);
+			}
+
+			mDifferential->mFinalDriveJoint = Racecar::GearJoint(lap.mFinalDriveRatio);
+			mClutch->mMaximumNormalForce = lap.mClutchNormalForce;
+			mWheel->mMaximumBrakingTorque = lap.mBrakingTorque;
+			mSpecification->ComputeTables();
+			mShiftMap = Racecar::ShiftMap(*mTransmission, mShiftEngineSpeed, mShiftEngineSpeed, kShiftHysteresis);
+			ComputeSpeedLimits();
+
+			//Starting in the highest gear that keeps the engine below the shift speed.
+			Racecar::Transmission& transmission(mDrivetrain.GetTransmission());
+			const Racecar::Real startWheelSpeed(mSettings.mStartSpeed / mWheel->mRadius);
+			Racecar::Gear startGear(Racecar::Gear::First);
+			while (static_cast<size_t>(startGear) < lap.mGearRatios.size() &&
+				startWheelSpeed * mSpecification->GetOverallRatio(startGear) > mShiftEngineSpeed)
+			{
+				startGear = static_cast<Racecar::Gear>(static_cast<size_t>(startGear) + 1);
+			}
+
+			mDrivetrain.Reset();
+			transmission.SelectGear(startGear);
+			mController.SetThrottlePosition(1.0f);
+			mController.SetBrakePosition(0.0f);
+			mDrivetrain.ControllerChange(mController);
+			mDrivetrain.SetLinearVelocity(mSettings.mStartSpeed);
+
+			const Racecar::Real fixedTime(mSettings.mFixedTimeStep);
+			const Racecar::Real lapLength(mSampleSpacing * (mCornerSpeeds.size() - 1));
+			const size_t numberOfSteps(static_cast<size_t>(mSettings.mMaximumLapTime / fixedTime));
+			Racecar::Real distance(0.0);
+			Racecar::Real previousSpeed(mSettings.mStartSpeed);
+			lap.mLapTime = std::numeric_limits<Racecar::Real>::max();
+
+			for (size_t step(1); step <= numberOfSteps; ++step)
+			{
+				const uint64_t noiseCounter(kDriverNoiseCounter + 2 * step);
+				const bool isBraking(previousSpeed > GetSpeedLimit(distance + lap.mBrakePointOffset));
+				const Racecar::Real throttle((true == isBraking) ? 0.0 : 1.0 - mSettings.mThrottleNoise * Racecar::RandomReal(lapSeed, noiseCounter));
+				const Racecar::Real brake((false == isBraking) ? 0.0 : 1.0 - mSettings.mBrakeNoise * Racecar::RandomReal(lapSeed, noiseCounter + 1));
+				mController.SetThrottlePosition(static_cast<float>(throttle));
+				mController.SetBrakePosition(static_cast<float>(brake));
+				mDrivetrain.ControllerChange(mController);
+
+				const Racecar::Gear selectedGear(transmission.GetSelectedGear());
+				const Racecar::Gear nextGear(mShiftMap.ComputeGear(selectedGear, static_cast<float>(throttle), transmission.GetAngularVelocity()));
+				if (nextGear != selectedGear)
+				{
+					transmission.SelectGear(nextGear);
+				}
+
+				mDrivetrain.Simulate(fixedTime);
+
+				//The finish is interpolated within the step so the lap time does not jump between time steps.
+				const Racecar::Real speed(mDrivetrain.GetLinearVelocity());
+				const Racecar::Real previousDistance(distance);
+				distance += (previousSpeed + speed) * 0.5 * fixedTime;
+				previousSpeed = speed;
+				if (distance >= lapLength)
+				{
+					lap.mLapTime = step * fixedTime - fixedTime * (distance - lapLength) / (distance - previousDistance);
+					break;
+				}
+			}
+		}
+
+	private:
+		static Racecar::Real ReverseRatio(const Racecar::TransmissionSpecification& transmission)
+		{
+			return (true == transmission.HasReverseGear()) ? transmission.GetGearJoint(Racecar::Gear::Reverse).GetGearRatio() : 0.0;
+		}
+
+		///
+		/// @details Works back from the end of the lap so the speed at each sample is one the racecar can brake from
+		///   in time for every corner ahead, braking at the grip or the brakes, whichever is less.
+		///
+		void ComputeSpeedLimits(void)
+		{
+			const Racecar::Real totalMass(mSpecification->mBodyMass + mWheel->mMass);
+			const Racecar::Real brakingDeceleration(std::min(mSettings.mGripCoefficient * Racecar::GetGravityConstant(),
+				mWheel->mMaximumBrakingTorque / (mWheel->mRadius * totalMass)));
+			const Racecar::Real brakingSpeedSquared(2.0 * brakingDeceleration * mSampleSpacing);
+
+			mSpeedLimits.back() = mCornerSpeeds.back();
+			for (size_t sampleIndex(mSpeedLimits.size() - 1); sampleIndex > 0; --sampleIndex)
+			{
+				const Racecar::Real nextLimit(mSpeedLimits[sampleIndex]);
+				mSpeedLimits[sampleIndex - 1] = std::min(mCornerSpeeds[sampleIndex - 1], sqrt(nextLimit * nextLimit + brakingSpeedSquared));
+			}
+		}
+
+		Racecar::Real GetSpeedLimit(const Racecar::Real& distance) const
+		{
+			const Racecar::Real lastSegment(static_cast<Racecar::Real>(mSpeedLimits.size() - 2));
+			const Racecar::Real position(std::min(std::max(distance / mSampleSpacing, Racecar::Real(0.0)), lastSegment + 1.0));
+			const Racecar::Real segment(std::min(std::floor(position), lastSegment));
+			const size_t index(static_cast<size_t>(segment));
+			return mSpeedLimits[index] + (mSpeedLimits[index + 1] - mSpeedLimits[index]) * (position - segment);
+		}
+
+		const Racecar::LapSimulatorSettings& mSettings;
+		const std::vector<Racecar::Real>& mCornerSpeeds;
+		Racecar::Real mSampleSpacing;
+		std::vector<Racecar::Real> mSpeedLimits;
+		std::shared_ptr<Racecar::ClutchSpecification> mClutch;
+		std::shared_ptr<Racecar::TransmissionSpecification> mTransmission;
+		std::shared_ptr<Racecar::DifferentialSpecification> mDifferential;
+		std::shared_ptr<Racecar::WheelSpecification> mWheel;
+		std::shared_ptr<Racecar::DrivetrainSpecification> mSpecification;
+		Racecar::Drivetrain mDrivetrain;
+		Racecar::ShiftMap mShiftMap;
+		Racecar::ProgrammaticController mController;
+		Racecar::Real mShiftEngineSpeed;
+	};
+
+	///
+	/// @details Draws the setup of a lap, each forward gear is kept no higher than the gear below it.
+	///
+	void DrawSetup(const Racecar::LapSimulatorSettings& settings, const uint64_t lapSeed, Racecar::LapRecord& lap)
+	{
+		const size_t numberOfGears(settings.mGearRatioBounds.size());
+		Racecar::DrawGearRatios(settings.mGearRatioBounds, lapSeed, 0, lap.mGearRatios);
+
+		lap.mFinalDriveRatio = Racecar::RandomReal(lapSeed, numberOfGears,
+			settings.mFinalDriveBounds.mMinimumRatio, settings.mFinalDriveBounds.mMaximumRatio);
+		lap.mClutchNormalForce = Racecar::RandomReal(lapSeed, numberOfGears + 1,
+			settings.mClutchNormalForce.mMinimum, settings.mClutchNormalForce.mMaximum);
+		lap.mBrakingTorque = Racecar::RandomReal(lapSeed, numberOfGears + 2,
+			settings.mBrakingTorque.mMinimum, settings.mBrakingTorque.mMaximum);
+		lap.mBrakePointOffset = Racecar::RandomReal(lapSeed, numberOfGears + 3,
+			-settings.mBrakePointNoise, settings.mBrakePointNoise);
+	}
+};
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::ParameterRange::ParameterRange(const Real& minimum, const Real& maximum) :
+	mMinimum(minimum),
+	mMaximum(maximum)
+{
+	error_if(mMaximum < mMinimum, "Expected the maximum to be at least the minimum.");
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::LapSimulatorSettings::LapSimulatorSettings(const std::vector<GearRatioBounds>& gearRatioBounds,
+	const GearRatioBounds& finalDriveBounds, const ParameterRange& clutchNormalForce, const ParameterRange& brakingTorque) :
+	mGearRatioBounds(gearRatioBounds),
+	mFinalDriveBounds(finalDriveBounds),
+	mClutchNormalForce(clutchNormalForce),
+	mBrakingTorque(brakingTorque),
+	mThrottleNoise(0.05),
+	mBrakeNoise(0.05),
+	mBrakePointNoise(2.0),
+	mGripCoefficient(1.0),
+	mStartSpeed(20.0),
+	mShiftEngineSpeed(-1.0),
+	mMaximumLapTime(300.0),
+	mHistogramResolution(0.01),
+	mFixedTimeStep(Racecar::kFixedTimeStep),
+	mFidelity(DrivetrainFidelity::Reduced),
+	mNumberOfLaps(1000),
+	mNumberOfThreads(0),
+	mSeed(0)
+{
+	error_if(true == mGearRatioBounds.empty(), "Expected bounds for at least one forward gear.");
+	error_if(mGearRatioBounds.size() > TransmissionSpecification::kMaximumForwardGears, "Too many forward gears for Racecar::Gear.");
+	error_if(false == HasDescendingMinimumRatios(mGearRatioBounds), "Expected the minimum ratio of each gear to be no higher than the gear below.");
+	error_if(mClutchNormalForce.mMinimum <= 0.0 || mBrakingTorque.mMinimum < 0.0, "Expected a positive clutch force and brake torque.");
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::LapTimeAggregator::LapTimeAggregator(const Real& maximumLapTime, const Real& histogramResolution) :
+	mMaximumLapTime(maximumLapTime),
+	mHistogramResolution(histogramResolution),
+	mHistogram(),
+	mNumberOfBins(0),
+	mNumberOfLaps(0),
+	mNumberOfUnfinished(0),
+	mTotalMicroseconds(0),
+	mFastestMicroseconds(std::numeric_limits<uint64_t>::max()),
+	mSlowestMicroseconds(0)
+{
+	error_if(mMaximumLapTime <= 0.0 || mHistogramResolution <= 0.0, "Expected a positive maximum lap time and histogram resolution.");
+
+	mNumberOfBins = static_cast<size_t>(std::ceil(mMaximumLapTime / mHistogramResolution)) + 1;
+	mHistogram.reset(new std::atomic<uint64_t>[mNumberOfBins]);
+	for (size_t binIndex(0); binIndex < mNumberOfBins; ++binIndex)
+	{
+		mHistogram[binIndex].store(0, std::memory_order_relaxed);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::LapTimeAggregator::AddLapTime(const Real& lapTime)
+{
+	if (lapTime > mMaximumLapTime || lapTime < 0.0)
+	{
+		mNumberOfUnfinished.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	const uint64_t microseconds(static_cast<uint64_t>(std::llround(lapTime * kMicrosecondsPerSecond)));
+	const size_t binIndex(std::min(static_cast<size_t>(lapTime / mHistogramResolution), mNumberOfBins - 1));
+	mHistogram[binIndex].fetch_add(1, std::memory_order_relaxed);
+	mTotalMicroseconds.fetch_add(microseconds, std::memory_order_relaxed);
+
+	uint64_t fastest(mFastestMicroseconds.load(std::memory_order_relaxed));
+	while (microseconds < fastest && false == mFastestMicroseconds.compare_exchange_weak(fastest, microseconds, std::memory_order_relaxed))
+	{
+	}
+
+	uint64_t slowest(mSlowestMicroseconds.load(std::memory_order_relaxed));
+	while (microseconds > slowest && false == mSlowestMicroseconds.compare_exchange_weak(slowest, microseconds, std::memory_order_relaxed))
+	{
+	}
+
+	//Counted last, so a reader never sees a lap that is not yet in the totals.
+	mNumberOfLaps.fetch_add(1, std::memory_order_release);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::LapTimeDistribution Racecar::LapTimeAggregator::GetDistribution(void) const
+{
+	LapTimeDistribution distribution;
+	distribution.mNumberOfLaps = static_cast<size_t>(mNumberOfLaps.load(std::memory_order_acquire));
+	distribution.mNumberOfUnfinished = static_cast<size_t>(mNumberOfUnfinished.load(std::memory_order_relaxed));
+	distribution.mHistogramResolution = mHistogramResolution;
+	distribution.mHistogram.resize(mNumberOfBins);
+	for (size_t binIndex(0); binIndex < mNumberOfBins; ++binIndex)
+	{
+		distribution.mHistogram[binIndex] = mHistogram[binIndex].load(std::memory_order_relaxed);
+	}
+
+	distribution.mFastestLapTime = 0.0;
+	distribution.mSlowestLapTime = 0.0;
+	distribution.mMeanLapTime = 0.0;
+	distribution.mMedianLapTime = 0.0;
+	distribution.mTenthPercentile = 0.0;
+	distribution.mNinetiethPercentile = 0.0;
+	if (0 == distribution.mNumberOfLaps)
+	{
+		return distribution;
+	}
+
+	distribution.mFastestLapTime = mFastestMicroseconds.load(std::memory_order_relaxed) / kMicrosecondsPerSecond;
+	distribution.mSlowestLapTime = mSlowestMicroseconds.load(std::memory_order_relaxed) / kMicrosecondsPerSecond;
+	distribution.mMeanLapTime = mTotalMicroseconds.load(std::memory_order_relaxed) / kMicrosecondsPerSecond / distribution.mNumberOfLaps;
+
+	//Each percentile is the middle of the bin it lands in, kept within the fastest and slowest laps.
+	const auto findPercentile = [&distribution](const Real& percentile) {
+		const uint64_t targetCount(static_cast<uint64_t>(std::ceil(percentile * distribution.mNumberOfLaps)));
+		uint64_t count(0);
+		for (size_t binIndex(0); binIndex < distribution.mHistogram.size(); ++binIndex)
+		{
+			count += distribution.mHistogram[binIndex];
+			if (count >= std::max(targetCount, uint64_t(1)))
+			{
+				const Real binTime((binIndex + 0.5) * distribution.mHistogramResolution);
+				return std::min(std::max(binTime, distribution.mFastestLapTime), distribution.mSlowestLapTime);
+			}
+		}
+
+		return distribution.mSlowestLapTime;
+	};
+
+	distribution.mTenthPercentile = findPercentile(0.1);
+	distribution.mMedianLapTime = findPercentile(0.5);
+	distribution.mNinetiethPercentile = findPercentile(0.9);
+	return distribution;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::LapSimulator::LapSimulator(const std::shared_ptr<const DrivetrainSpecification>& vehicle, TrackProfile& lap,
+	const LapSimulatorSettings& settings) :
+	mVehicle(vehicle),
+	mSettings(settings),
+	mCornerSpeeds(lap.GetNumberOfSamples()),
+	mSampleSpacing(lap.GetSampleSpacing())
+{
+	error_if(nullptr == mVehicle, "LapSimulator expects a vehicle specification.");
+	error_if(mSettings.mNumberOfLaps == 0, "Expected at least one lap.");
+	error_if(mSettings.mMaximumLapTime <= 0.0 || mSettings.mFixedTimeStep <= 0.0, "Expected a positive lap time and time step.");
+	error_if(mSettings.mGripCoefficient <= 0.0 || mSettings.mStartSpeed < 0.0, "Expected a positive grip and a start speed that is not negative.");
+
+	//The fastest each corner can be taken at is where the grip holds the racecar on the circle,  v^2 * k = mu * g.
+	for (size_t sampleIndex(0); sampleIndex < mCornerSpeeds.size(); ++sampleIndex)
+	{
+		const Real curvature(fabs(lap.GetCurvature(sampleIndex * mSampleSpacing)));
+		mCornerSpeeds[sampleIndex] = (curvature < kMinimumCurvature) ? kUnlimitedSpeed :
+			std::min(kUnlimitedSpeed, sqrt(mSettings.mGripCoefficient * Racecar::GetGravityConstant() / curvature));
+	}
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::LapSimulator::~LapSimulator(void)
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::LapSimulationResult Racecar::LapSimulator::Simulate(void) const
+{
+	LapTimeAggregator aggregator(mSettings.mMaximumLapTime, mSettings.mHistogramResolution);
+	return Simulate(aggregator);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::LapSimulationResult Racecar::LapSimulator::Simulate(LapTimeAggregator& aggregator) const
+{
+	const size_t numberOfLaps(mSettings.mNumberOfLaps);
+	const size_t numberOfThreads(std::min(numberOfLaps, (mSettings.mNumberOfThreads > 0) ? mSettings.mNumberOfThreads :
+		std::max(static_cast<size_t>(std::thread::hardware_concurrency()), size_t(1))));
+
+	//Everything the threads write to is sized up front, each lap is written by exactly one thread.
+	LapSimulationResult result;
+	result.mLaps.resize(numberOfLaps);
+	for (LapRecord& lap : result.mLaps)
+	{
+		lap.mGearRatios.resize(mSettings.mGearRatioBounds.size());
+	}
+
+	//An error escaping a thread would terminate the program, so the first is kept and the remaining laps skipped,
+	//  then thrown again once every thread has joined.
+	std::atomic<size_t> nextLap(0);
+	std::exception_ptr firstError;
+	std::mutex errorMutex;
+	const auto simulateLaps = [&]() {
+		try
+		{
+			LapDriver lapDriver(*mVehicle, mSettings, mCornerSpeeds, mSampleSpacing);
+			for (size_t lapIndex(nextLap++); lapIndex < numberOfLaps; lapIndex = nextLap++)
+			{
+				const uint64_t lapSeed(Racecar::RandomBits(mSettings.mSeed, lapIndex));
+				LapRecord& lap(result.mLaps[lapIndex]);
+				DrawSetup(mSettings, lapSeed, lap);
+				lapDriver.Simulate(lapSeed, lap);
+				aggregator.AddLapTime(lap.mLapTime);
+			}
+		}
+		catch (...)
+		{
+			nextLap = numberOfLaps;
+			std::lock_guard<std::mutex> lock(errorMutex);
+			if (nullptr == firstError)
+			{
+				firstError = std::current_exception();
+			}
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (size_t threadIndex(1); threadIndex < numberOfThreads; ++threadIndex)
+	{
+		threads.emplace_back(simulateLaps);
+	}
+
+	simulateLaps();
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	if (nullptr != firstError)
+	{
+		std::rethrow_exception(firstError);
+	}
+
+	result.mFastest = *std::min_element(result.mLaps.begin(), result.mLaps.end(),
+		[](const LapRecord& a, const LapRecord& b) { return a.mLapTime < b.mLapTime; });
+	result.mDistribution = aggregator.GetDistribution();
+	return result;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
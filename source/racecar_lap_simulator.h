@@ -0,0 +1,168 @@
+///
+/// @file
+/// @details Runs many laps of a track in parallel, varying the setup of the racecar and the inputs of the driver, to
+///   find the distribution of lap times a setup can be expected to give.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#ifndef _Racecar_LapSimulator_h_
+#define _Racecar_LapSimulator_h_
+
+#include "racecar.h"
+#include "racecar_drivetrain.h"
+#include "racecar_gear_optimizer.h"
+#include "racecar_track_profile.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Racecar
+{
+
+	struct ParameterRange
+	{
+		ParameterRange(const Real& minimum, const Real& maximum);
+
+		Real mMinimum;
+		Real mMaximum;
+	};
+
+	struct LapSimulatorSettings
+	{
+		///
+		/// @param gearRatioBounds The range of ratios to draw for each forward gear starting from First, the number of
+		///   bounds is the number of forward gears of each lap, with descending minimum ratios as GearOptimizerSettings.
+		/// @param clutchNormalForce The range of the maximum normal force of the clutch, in Newtons.
+		/// @param brakingTorque The range of the maximum braking torque of the wheel, in Newton-meters.
+		///
+		explicit LapSimulatorSettings(const std::vector<GearRatioBounds>& gearRatioBounds, const GearRatioBounds& finalDriveBounds,
+			const ParameterRange& clutchNormalForce, const ParameterRange& brakingTorque);
+
+		std::vector<GearRatioBounds> mGearRatioBounds;
+		GearRatioBounds mFinalDriveBounds;
+		ParameterRange mClutchNormalForce;
+		ParameterRange mBrakingTorque;
+		Real mThrottleNoise;        //The most the throttle falls short of full each step, defaults to 0.05.
+		Real mBrakeNoise;           //The most the brake falls short of full each step, defaults to 0.05.
+		Real mBrakePointNoise;      //meters the driver brakes early or late for the lap, defaults to 2.
+		Real mGripCoefficient;      //The lateral grip the corners are taken at, defaults to 1.
+		Real mStartSpeed;           //meters / second crossing the start line, defaults to 20.
+		Real mShiftEngineSpeed;     //radians / second, defaults to -1.0 for 95% of the maximum engine speed.
+		Real mMaximumLapTime;       //seconds each lap is simulated for at most, defaults to 300.
+		Real mHistogramResolution;  //seconds covered by each bin of the lap time histogram, defaults to 0.01.
+		Real mFixedTimeStep;        //seconds, defaults to Racecar::kFixedTimeStep.
+		DrivetrainFidelity mFidelity; //defaults to Reduced, the clutch force only matters in Full where the clutch can slip.
+		size_t mNumberOfLaps;       //defaults to 1000.
+		size_t mNumberOfThreads;    //defaults to 0 for one per hardware thread.
+		uint64_t mSeed;
+	};
+
+	///
+	/// @details The setup drawn for a lap and the time it took, which is std::numeric_limits<Real>::max() for a lap
+	///   not finished within the maximum lap time.
+	///
+	struct LapRecord
+	{
+		std::vector<Real> mGearRatios;
+		Real mFinalDriveRatio;
+		Real mClutchNormalForce;  //N
+		Real mBrakingTorque;      //Nm
+		Real mBrakePointOffset;   //meters, positive for braking early.
+		Real mLapTime;            //seconds
+	};
+
+	struct LapTimeDistribution
+	{
+		size_t mNumberOfLaps;         //Finished laps only.
+		size_t mNumberOfUnfinished;
+		Real mFastestLapTime;         //seconds, each is 0 when no lap finished.
+		Real mSlowestLapTime;
+		Real mMeanLapTime;
+		Real mMedianLapTime;          //The percentiles are to the resolution of the histogram.
+		Real mTenthPercentile;
+		Real mNinetiethPercentile;
+		Real mHistogramResolution;    //seconds
+		std::vector<uint64_t> mHistogram; //Laps finished in each bin, the first starting at 0 seconds.
+	};
+
+	///
+	/// @details Collects lap times from any number of threads without locking, every value is kept as an integer of
+	///   microseconds so the totals are the same whatever order the laps arrive in. The distribution can be read
+	///   while laps are still being added, to watch a long run.
+	///
+	class LapTimeAggregator
+	{
+	public:
+		explicit LapTimeAggregator(const Real& maximumLapTime, const Real& histogramResolution);
+
+		LapTimeAggregator(const LapTimeAggregator& other) = delete;
+		LapTimeAggregator& operator=(const LapTimeAggregator& other) = delete;
+
+		///
+		/// @details Adds the lap time in seconds, a time beyond the maximum lap time counts as unfinished.
+		///
+		void AddLapTime(const Real& lapTime);
+
+		LapTimeDistribution GetDistribution(void) const;
+
+	private:
+		Real mMaximumLapTime;
+		Real mHistogramResolution;
+		std::unique_ptr<std::atomic<uint64_t>[]> mHistogram;
+		size_t mNumberOfBins;
+		std::atomic<uint64_t> mNumberOfLaps;
+		std::atomic<uint64_t> mNumberOfUnfinished;
+		std::atomic<uint64_t> mTotalMicroseconds;
+		std::atomic<uint64_t> mFastestMicroseconds;
+		std::atomic<uint64_t> mSlowestMicroseconds;
+	};
+
+	struct LapSimulationResult
+	{
+		std::vector<LapRecord> mLaps;  //In the order they were drawn, which does not depend on the number of threads.
+		LapRecord mFastest;
+		LapTimeDistribution mDistribution;
+	};
+
+	///
+	/// @details Drives a lap of the track for each setup, from a flying start at the start speed. The driver holds the
+	///   throttle until the racecar is faster than it could brake down to the grip of each corner ahead, then brakes,
+	///   shifting at the shift speed. Each lap draws the setup and the driver noise from counter based random numbers
+	///   keyed by the index of the lap, so the results do not depend on the number of threads. Each thread builds a
+	///   single drive-train and rewrites its own specifications in place between laps.
+	///
+	/// @note Only the curvature of the track is used, the drive-train does not have the grade of the track.
+	///
+	class LapSimulator
+	{
+	public:
+		///
+		/// @param vehicle Provides every component of the racecar, the forward ratios, final drive, clutch force and
+		///   brake torque come from the setup of each lap.
+		/// @param lap Read once for the corners of the lap, the length of the lap is the length of the profile.
+		///
+		explicit LapSimulator(const std::shared_ptr<const DrivetrainSpecification>& vehicle, TrackProfile& lap,
+			const LapSimulatorSettings& settings);
+		~LapSimulator(void);
+
+		LapSimulationResult Simulate(void) const;
+
+		///
+		/// @details Simulates every lap, adding each lap time to the aggregator as it finishes.
+		///
+		LapSimulationResult Simulate(LapTimeAggregator& aggregator) const;
+
+	private:
+		std::shared_ptr<const DrivetrainSpecification> mVehicle;
+		LapSimulatorSettings mSettings;
+		std::vector<Real> mCornerSpeeds;  //meters / second the grip allows at each sample of the lap.
+		Real mSampleSpacing;              //meters
+	};
+
+};	/* namespace Racecar */
+
+#endif /* _Racecar_LapSimulator_h_ */
@@ -0,0 +1,82 @@
+///
+/// @file
+/// @details A simulation of a clutch-type limited-slip differential, where a clutch pack between the outputs resists
+///   the left and right wheels turning at different speeds.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#include "racecar_limited_slip_differential.h"
+
+namespace
+{
+	const Racecar::Real kLockingFrictionCoefficient(1.0); //The locking torque already includes the friction of the clutch pack.
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Racecar::LimitedSlipDifferentialSpecification::LimitedSlipDifferentialSpecification(const Real& momentOfInertia,
+	const Real& finalDriveRatio, const Real& preloadTorque, const Real& powerRampCoefficient, const Real& coastRampCoefficient) :
+	DifferentialSpecification(momentOfInertia, finalDriveRatio),
+	mPreloadTorque(preloadTorque),
+	mPowerRampCoefficient(powerRampCoefficient),
+	mCoastRampCoefficient(coastRampCoefficient)
+{
+	error_if(mPreloadTorque < 0.0 || mPowerRampCoefficient < 0.0 || mCoastRampCoefficient < 0.0,
+		"LimitedSlipDifferential expects a positive preload and ramp coefficients.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+Racecar::LimitedSlipDifferential::LimitedSlipDifferential(const std::shared_ptr<const LimitedSlipDifferentialSpecification>& specification) :
+	OpenDifferential(specification),
+	mLockingJoint()
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Racecar::LimitedSlipDifferential::~LimitedSlipDifferential(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::LimitedSlipDifferential::OnSimulate(const Real& fixedTime)
+{
+	OpenDifferential::OnSimulate(fixedTime);
+
+	const LimitedSlipDifferentialSpecification& specification(GetSpecificationAs<LimitedSlipDifferentialSpecification>());
+	const Real carrierTorque(GetInputTorque() * specification.mFinalDriveJoint.GetGearRatio());
+	const bool isCoasting(carrierTorque * GetAngularVelocity() < 0.0);
+	const Real rampCoefficient((true == isCoasting) ? specification.mCoastRampCoefficient : specification.mPowerRampCoefficient);
+	mLockingJoint.SetNormalForce(specification.mPreloadTorque + rampCoefficient * fabs(carrierTorque));
+
+	RotatingBody& leftOutput(GetLeftOutput());
+	RotatingBody& rightOutput(GetRightOutput());
+	const Real leftInertia(leftOutput.ComputeDownstreamInertia());
+	const Real rightInertia(rightOutput.ComputeDownstreamInertia());
+	const Real carrierInertia(ComputeCarrierInertia());
+
+	//With the carrier at the average speed, the outputs move as  wl = wc + d/2  and  wr = wc - d/2  so the inertia
+	//against the difference d, once the carrier is free to move, is  det(M) / Mcc  of the mass matrix in (wc, d):
+	//  M = | Ic + Il + Ir    (Il - Ir) / 2 |
+	//      | (Il - Ir) / 2   (Il + Ir) / 4 |
+	const Real totalInertia(carrierInertia + leftInertia + rightInertia);
+	const Real inertiaDifference(leftInertia - rightInertia);
+	const Real determinant((totalInertia * (leftInertia + rightInertia) - inertiaDifference * inertiaDifference) * 0.25);
+	const Real speedDifference(leftOutput.GetAngularVelocity() - rightOutput.GetAngularVelocity());
+	const Real matchingImpulse(speedDifference * determinant / totalInertia);
+
+	const Real appliedImpulse(mLockingJoint.ComputeFrictionImpulse(matchingImpulse, kLockingFrictionCoefficient,
+		kLockingFrictionCoefficient, fixedTime));
+	if (fabs(appliedImpulse) > kEpsilon)
+	{
+		ApplyOutputImpulses(-appliedImpulse, appliedImpulse);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
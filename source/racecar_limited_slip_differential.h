@@ -0,0 +1,74 @@
+///
+/// @file
+/// @details A simulation of a clutch-type limited-slip differential, where a clutch pack between the outputs resists
+///   the left and right wheels turning at different speeds.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#ifndef _Racecar_LimitedSlipDifferential_h_
+#define _Racecar_LimitedSlipDifferential_h_
+
+#include "racecar_open_differential.h"
+#include "racecar_friction_joint.h"
+
+#include <memory>
+
+namespace Racecar
+{
+
+	///
+	/// @details The clutch pack of a limited-slip differential, the locking torque is the preload plus the torque at the
+	///   carrier multiplied by the ramp coefficient for the direction of the torque. A coast coefficient of zero is a
+	///   1-way differential, and equal power and coast coefficients a 2-way.
+	///
+	struct LimitedSlipDifferentialSpecification : public DifferentialSpecification
+	{
+		explicit LimitedSlipDifferentialSpecification(const Real& momentOfInertia, const Real& finalDriveRatio,
+			const Real& preloadTorque, const Real& powerRampCoefficient, const Real& coastRampCoefficient);
+
+		Real mPreloadTorque;          //Nm
+		Real mPowerRampCoefficient;   //Locking torque for each Nm at the carrier while driving.
+		Real mCoastRampCoefficient;   //Locking torque for each Nm at the carrier while engine braking.
+	};
+
+	///
+	/// @details An OpenDifferential with a clutch pack between the outputs. Each step the locking torque is found from the
+	///   torque delivered to the input, and the impulse that would bring the outputs to the same speed, with the carrier
+	///   held at their average, is found in closed form and limited by the clutch pack.
+	///
+	class LimitedSlipDifferential : public OpenDifferential
+	{
+	public:
+		///
+		/// @details Creates a differential that shares the specification with any other differentials created from it.
+		///
+		explicit LimitedSlipDifferential(const std::shared_ptr<const LimitedSlipDifferentialSpecification>& specification);
+		virtual ~LimitedSlipDifferential(void);
+
+		inline std::shared_ptr<const LimitedSlipDifferentialSpecification> GetLimitedSlipSpecification(void) const
+		{
+			return GetSharedSpecificationAs<LimitedSlipDifferentialSpecification>();
+		}
+
+		///
+		/// @details Returns the torque in Nm the clutch pack could hold during the last step.
+		///
+		inline const Real& GetLockingTorque(void) const { return mLockingJoint.GetNormalForce(); }
+
+		///
+		/// @details True when the clutch pack held the outputs together for the last step.
+		///
+		inline bool IsLocked(void) const { return mLockingJoint.IsLocked(); }
+
+	protected:
+		virtual void OnSimulate(const Real& fixedTime) override;
+
+	private:
+		FrictionJoint mLockingJoint;
+	};
+
+};	/* namespace Racecar */
+
+#endif /* _Racecar_LimitedSlipDifferential_h_ */
@@ -10,12 +10,28 @@
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-Racecar::LockedDifferential::LockedDifferential(const Real& momentOfInertia, const Real& finalDriveRatio) :
-	RotatingBody(momentOfInertia),
+Racecar::DifferentialSpecification::DifferentialSpecification(const Real& momentOfInertia, const Real& finalDriveRatio) :
+	RotatingBodySpecification(momentOfInertia),
 	mFinalDriveJoint(finalDriveRatio)
 {
 }
 
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+Racecar::LockedDifferential::LockedDifferential(const Real& momentOfInertia, const Real& finalDriveRatio) :
+	LockedDifferential(std::make_shared<const DifferentialSpecification>(momentOfInertia, finalDriveRatio))
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Racecar::LockedDifferential::LockedDifferential(const std::shared_ptr<const DifferentialSpecification>& specification) :
+	RotatingBody(specification, kNoControllerChannels)
+{
+}
+
 //--------------------------------------------------------------------------------------------------------------------//
 
 Racecar::LockedDifferential::~LockedDifferential(void)
@@ -44,7 +60,7 @@ Racecar::Real Racecar::LockedDifferential::ComputeDownstreamInertia(void) const
 	//return RotatingBody::ComputeDownstreamInertia() / mFinalDriveJoint.GetGearRatio();
 
 	//https://www.servo2go.com/support/files/Smart%20Motion%20Cheat%20Sheet%20Rev3.pdf
-	const Real oneOverRatioSquared((1 / mFinalDriveJoint.GetGearRatio()) * (1 / mFinalDriveJoint.GetGearRatio()));
+	const Real oneOverRatioSquared(GetFinalDriveJoint().GetInverseGearRatioSquared());
 	return RotatingBody::ComputeDownstreamInertia() * oneOverRatioSquared;
 }
 
@@ -56,7 +72,7 @@ Racecar::Real Racecar::LockedDifferential::ComputeUpstreamInertia(void) const
 	const Real upstreamInertia((nullptr == inputSource) ? 0.0 : inputSource->ComputeUpstreamInertia());
 	//return GetInertia() + upstreamInertia * mFinalDriveJoint.GetGearRatio();
 
-	const Real ratioSquared(mFinalDriveJoint.GetGearRatio() * mFinalDriveJoint.GetGearRatio());
+	const Real ratioSquared(GetFinalDriveJoint().GetGearRatioSquared());
 	return RotatingBody::ComputeDownstreamInertia() * ratioSquared;
 }
 
@@ -70,7 +86,7 @@ void Racecar::LockedDifferential::OnDownstreamAngularVelocityChange(const Real&
 	//const Real outputAngularVelocityChange(inputImpulse / (upstreamInertia + (downstreamInertia * mFinalDriveJoint.GetGearRatio())));
 
 	//RotatingBody::OnDownstreamAngularVelocityChange(outputAngularVelocityChange, fromSource);
-	RotatingBody::OnDownstreamAngularVelocityChange(changeInAngularVelocity / mFinalDriveJoint.GetGearRatio());
+	RotatingBody::OnDownstreamAngularVelocityChange(changeInAngularVelocity * GetFinalDriveJoint().GetInverseGearRatio());
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -97,7 +113,7 @@ void Racecar::LockedDifferential::OnUpstreamAngularVelocityChange(const Real& ch
 	RotatingBody* inputSource(GetInputSource());
 	if (nullptr != inputSource)
 	{
-		inputSource->OnUpstreamAngularVelocityChange(changeInAngularVelocity * mFinalDriveJoint.GetGearRatio());
+		inputSource->OnUpstreamAngularVelocityChange(changeInAngularVelocity * GetFinalDriveJoint().GetGearRatio());
 	}
 }
 
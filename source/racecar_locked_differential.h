@@ -12,17 +12,40 @@
 #include "rotating_body.h"
 #include "racecar_transmission.h" //For GearJoint
 
+#include <memory>
+
 namespace Racecar
 {
 
+	///
+	/// @details The final drive and inertia of a differential which do not change while simulating, a single
+	///   specification can be shared by every differential of the same model.
+	///
+	struct DifferentialSpecification : public RotatingBodySpecification
+	{
+		explicit DifferentialSpecification(const Real& momentOfInertia, const Real& finalDriveRatio);
+
+		GearJoint mFinalDriveJoint;
+	};
+
 	class RacecarControllerInterface;
 
 	class LockedDifferential : public RotatingBody
 	{
 	public:
 		explicit LockedDifferential(const Real& momentOfInertia, const Real& finalDriveRatio);
+
+		///
+		/// @details Creates a differential that shares the specification with any other differentials created from it.
+		///
+		explicit LockedDifferential(const std::shared_ptr<const DifferentialSpecification>& specification);
 		virtual ~LockedDifferential(void);
 
+		inline std::shared_ptr<const DifferentialSpecification> GetSpecification(void) const
+		{
+			return GetSharedSpecificationAs<DifferentialSpecification>();
+		}
+
 		virtual Real ComputeDownstreamInertia(void) const override;
 		virtual Real ComputeUpstreamInertia(void) const override;
 
@@ -32,7 +55,10 @@ namespace Racecar
 		virtual void OnUpstreamAngularVelocityChange(const Real& changeInAngularVelocity) override;
 
 	private:
-		GearJoint mFinalDriveJoint;
+		inline const GearJoint& GetFinalDriveJoint(void) const
+		{
+			return GetSpecificationAs<DifferentialSpecification>().mFinalDriveJoint;
+		}
 	};
 
 };	/* namespace Racecar */
@@ -0,0 +1,172 @@
+///
+/// @file
+/// @details A simulation of an open differential, where the left and right wheels can turn at different speeds while
+///   the carrier turns at the average of their speeds.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#include "racecar_open_differential.h"
+
+#include <limits>
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Racecar::OpenDifferential::OpenDifferential(const Real& momentOfInertia, const Real& finalDriveRatio) :
+	OpenDifferential(std::make_shared<const DifferentialSpecification>(momentOfInertia, finalDriveRatio))
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Racecar::OpenDifferential::OpenDifferential(const std::shared_ptr<const DifferentialSpecification>& specification) :
+	RotatingBody(specification, kNoControllerChannels),
+	mInputImpulse(0.0),
+	mInputTorque(0.0)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Racecar::OpenDifferential::~OpenDifferential(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Racecar::RotatingBody& Racecar::OpenDifferential::GetLeftOutput(void)
+{
+	error_if(2 != GetNumberOfOutputSources(), "OpenDifferential expects a left and right output.");
+	return GetExpectedOutputSource(0);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Racecar::RotatingBody& Racecar::OpenDifferential::GetRightOutput(void)
+{
+	error_if(2 != GetNumberOfOutputSources(), "OpenDifferential expects a left and right output.");
+	return GetExpectedOutputSource(1);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::OpenDifferential::OnSimulate(const Real& fixedTime)
+{
+	RotatingBody::OnSimulate(fixedTime);
+
+	//Removes any drift, such as an output having its speed set directly.
+	SolveConstraint();
+
+	mInputTorque = mInputImpulse / fixedTime;
+	mInputImpulse = 0.0;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::OpenDifferential::ComputeDownstreamInertia(void) const
+{
+	error_if(2 != GetNumberOfOutputSources(), "OpenDifferential expects a left and right output.");
+	const Real leftInertia(GetExpectedOutputSource(0).ComputeDownstreamInertia());
+	const Real rightInertia(GetExpectedOutputSource(1).ComputeDownstreamInertia());
+
+	//An input impulse J turns into  r*J  at the carrier, split evenly so the input speeds up by
+	//  r^2 * J / 4 * (1/Il + 1/Ir)  which is the same as the locked differential when both outputs are equal.
+	const Real outputInertia(4.0 * leftInertia * rightInertia / (leftInertia + rightInertia));
+	return (GetInertia() + outputInertia) * GetFinalDriveJoint().GetInverseGearRatioSquared();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::OpenDifferential::ComputeUpstreamInertia(void) const
+{
+	return 0.0;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::OpenDifferential::ComputeCarrierInertia(void) const
+{
+	const RotatingBody* inputSource(GetInputSource());
+	const Real upstreamInertia((nullptr == inputSource) ? 0.0 : inputSource->ComputeUpstreamInertia());
+	return GetInertia() + upstreamInertia * GetFinalDriveJoint().GetGearRatioSquared();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::OpenDifferential::OnDownstreamAngularVelocityChange(const Real& changeInAngularVelocity)
+{
+	RotatingBody& leftOutput(GetLeftOutput());
+	RotatingBody& rightOutput(GetRightOutput());
+	const Real leftInertia(leftOutput.ComputeDownstreamInertia());
+	const Real rightInertia(rightOutput.ComputeDownstreamInertia());
+
+	mInputImpulse += changeInAngularVelocity * ComputeDownstreamInertia();
+
+	//The carrier follows the input through the final drive, and each output receives an equal share of the impulse
+	//left after the carrier, which leaves the carrier at the average speed of the outputs.
+	const Real carrierVelocityChange(changeInAngularVelocity * GetFinalDriveJoint().GetInverseGearRatio());
+	const Real outputImpulse(2.0 * carrierVelocityChange * leftInertia * rightInertia / (leftInertia + rightInertia));
+
+	SetAngularVelocity(GetAngularVelocity() + carrierVelocityChange);
+	leftOutput.OnDownstreamAngularVelocityChange(outputImpulse / leftInertia);
+	rightOutput.OnDownstreamAngularVelocityChange(outputImpulse / rightInertia);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::OpenDifferential::OnUpstreamAngularVelocityChange(const Real& changeInAngularVelocity)
+{
+	//The output has already changed speed on its own, see ComputeUpstreamInertia(), so the rest of the drive-train only
+	//needs to follow the constraint.
+	((void)changeInAngularVelocity);
+	SolveConstraint();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::OpenDifferential::ApplyOutputImpulses(const Real& leftImpulse, const Real& rightImpulse)
+{
+	RotatingBody& leftOutput(GetLeftOutput());
+	RotatingBody& rightOutput(GetRightOutput());
+	leftOutput.OnDownstreamAngularVelocityChange(leftImpulse / leftOutput.ComputeDownstreamInertia());
+	rightOutput.OnDownstreamAngularVelocityChange(rightImpulse / rightOutput.ComputeDownstreamInertia());
+	SolveConstraint();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::OpenDifferential::SolveConstraint(void)
+{
+	RotatingBody& leftOutput(GetLeftOutput());
+	RotatingBody& rightOutput(GetRightOutput());
+	const Real leftInertia(leftOutput.ComputeDownstreamInertia());
+	const Real rightInertia(rightOutput.ComputeDownstreamInertia());
+	const Real carrierInertia(ComputeCarrierInertia());
+
+	//The constraint  C = (wl + wr) / 2 - wc  is linear, so the impulse that zeroes it is found directly:
+	//  J = C / (1/(4*Il) + 1/(4*Ir) + 1/Ic)   pushing the carrier by J and pulling each output by J/2.
+	const Real violation((leftOutput.GetAngularVelocity() + rightOutput.GetAngularVelocity()) * 0.5 - GetAngularVelocity());
+	if (fabs(violation) <= std::numeric_limits<Real>::epsilon())
+	{
+		return;
+	}
+
+	const Real impulse(violation / (0.25 / leftInertia + 0.25 / rightInertia + 1.0 / carrierInertia));
+	const Real carrierVelocityChange(impulse / carrierInertia);
+
+	//Whatever pushes the upstream bodies along is taken back out of the impulse delivered to the input.
+	mInputImpulse -= (carrierInertia - GetInertia()) * carrierVelocityChange * GetFinalDriveJoint().GetInverseGearRatio();
+
+	SetAngularVelocity(GetAngularVelocity() + carrierVelocityChange);
+	RotatingBody* inputSource(GetInputSource());
+	if (nullptr != inputSource)
+	{
+		inputSource->OnUpstreamAngularVelocityChange(carrierVelocityChange * GetFinalDriveJoint().GetGearRatio());
+	}
+
+	leftOutput.OnDownstreamAngularVelocityChange(-0.5 * impulse / leftInertia);
+	rightOutput.OnDownstreamAngularVelocityChange(-0.5 * impulse / rightInertia);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
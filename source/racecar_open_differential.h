@@ -0,0 +1,99 @@
+///
+/// @file
+/// @details A simulation of an open differential, where the left and right wheels can turn at different speeds while
+///   the carrier turns at the average of their speeds.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#ifndef _Racecar_OpenDifferential_h_
+#define _Racecar_OpenDifferential_h_
+
+#include "rotating_body.h"
+#include "racecar_locked_differential.h" //For DifferentialSpecification
+
+#include <memory>
+
+namespace Racecar
+{
+
+	///
+	/// @details Splits the torque from the input equally between two outputs, the first output added is the left and the
+	///   second is the right, and the carrier is held at the average speed of the outputs. The constraint between the
+	///   input, carrier and outputs is solved in closed form with a single impulse, so the cost of each step does not
+	///   depend on how far the constraint drifted.
+	///
+	class OpenDifferential : public RotatingBody
+	{
+	public:
+		explicit OpenDifferential(const Real& momentOfInertia, const Real& finalDriveRatio);
+
+		///
+		/// @details Creates a differential that shares the specification with any other differentials created from it.
+		///
+		explicit OpenDifferential(const std::shared_ptr<const DifferentialSpecification>& specification);
+		virtual ~OpenDifferential(void);
+
+		inline std::shared_ptr<const DifferentialSpecification> GetSpecification(void) const
+		{
+			return GetSharedSpecificationAs<DifferentialSpecification>();
+		}
+
+		///
+		/// @details Returns the torque in Nm delivered to the input of the differential during the last step, including
+		///   any of it taken back by the constraint.
+		///
+		inline const Real& GetInputTorque(void) const { return mInputTorque; }
+
+		///
+		/// @details Returns the inertia seen at the input, where the outputs are connected through the equal torque split
+		///   so a light output on one side, such as a wheel in the air, reduces the inertia as it would in reality.
+		///
+		virtual Real ComputeDownstreamInertia(void) const override;
+
+		///
+		/// @details Returns zero, as the inertia seen by an output depends on which output asks. An output changing speed
+		///   is instead corrected by the constraint impulse in OnUpstreamAngularVelocityChange().
+		///
+		virtual Real ComputeUpstreamInertia(void) const override;
+
+	protected:
+		virtual void OnSimulate(const Real& fixedTime) override;
+		virtual void OnDownstreamAngularVelocityChange(const Real& changeInAngularVelocity) override;
+		virtual void OnUpstreamAngularVelocityChange(const Real& changeInAngularVelocity) override;
+
+		///
+		/// @details Returns the inertia that turns with the carrier, including everything upstream of the input reflected
+		///   through the final drive.
+		///
+		Real ComputeCarrierInertia(void) const;
+
+		///
+		/// @details Applies an impulse to each output, in kg-m^2 / s, then solves the constraint so the carrier is left at
+		///   the average speed of the outputs.
+		///
+		void ApplyOutputImpulses(const Real& leftImpulse, const Real& rightImpulse);
+
+		///
+		/// @details Applies the single impulse between the carrier and the outputs that brings the carrier back to the
+		///   average speed of the outputs.
+		///
+		void SolveConstraint(void);
+
+		RotatingBody& GetLeftOutput(void);
+		RotatingBody& GetRightOutput(void);
+
+	private:
+		inline const GearJoint& GetFinalDriveJoint(void) const
+		{
+			return GetSpecificationAs<DifferentialSpecification>().mFinalDriveJoint;
+		}
+
+		Real mInputImpulse;  //kg-m^2 / s delivered to the input since the last step.
+		Real mInputTorque;   //Nm
+	};
+
+};	/* namespace Racecar */
+
+#endif /* _Racecar_OpenDifferential_h_ */
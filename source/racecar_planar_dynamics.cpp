@@ -0,0 +1,176 @@
+///
+/// @file
+/// @details The motion of the racecar across the ground in the plane, with the sideways slip and yaw of the body from
+///   the lateral force of each tire as the front wheels are steered.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#include "racecar_planar_dynamics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+constexpr Racecar::Real Racecar::PlanarDynamics::kMinimumSlipSpeed;
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::PlanarDynamicsSpecification::PlanarDynamicsSpecification(const Real& yawInertia, const Real& wheelbase,
+	const Real& frontWeightFraction, const Real& maximumSteeringAngle, const Real& corneringStiffness) :
+	mYawInertia(yawInertia),
+	mWheelbase(wheelbase),
+	mFrontWeightFraction(frontWeightFraction),
+	mMaximumSteeringAngle(maximumSteeringAngle),
+	mCorneringStiffness(corneringStiffness)
+{
+	error_if(mYawInertia <= 0.0 || mWheelbase <= 0.0, "Expected a positive yaw inertia and wheelbase.");
+	error_if(mFrontWeightFraction < 0.0 || mFrontWeightFraction > 1.0, "Expected the front weight fraction from 0 to 1.");
+	error_if(mMaximumSteeringAngle < 0.0 || mCorneringStiffness < 0.0, "Expected a steering angle and cornering stiffness that are not negative.");
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::PlanarDynamics::PlanarDynamics(const std::shared_ptr<const PlanarDynamicsSpecification>& specification) :
+	mSpecification(specification),
+	mCornerPositions(),
+	mSteeringShares(),
+	mLateralForces(),
+	mPositionX(0.0),
+	mPositionY(0.0),
+	mHeading(0.0),
+	mLateralVelocity(0.0),
+	mYawRate(0.0)
+{
+	error_if(nullptr == mSpecification, "PlanarDynamics expects a specification.");
+
+	//The center of mass sits closer to the axle carrying more of the weight.
+	const Real frontPosition(mSpecification->mWheelbase * (1.0 - mSpecification->mFrontWeightFraction));
+	const Real rearPosition(frontPosition - mSpecification->mWheelbase);
+	mCornerPositions = CornerValues{ { frontPosition, frontPosition, rearPosition, rearPosition } };
+	mSteeringShares = CornerValues{ { 1.0, 1.0, 0.0, 0.0 } };
+	Reset();
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::PlanarDynamics::Reset(const Real& positionX, const Real& positionY, const Real& heading)
+{
+	mLateralForces.fill(0.0);
+	mPositionX = positionX;
+	mPositionY = positionY;
+	mHeading = heading;
+	mLateralVelocity = 0.0;
+	mYawRate = 0.0;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::PlanarDynamics::Simulate(Real& longitudinalVelocity, const Real& steeringPosition, const Real& totalMass,
+	const std::array<Real, kNumberOfCorners>& normalLoads, const std::array<Real, kNumberOfCorners>& gripLimits,
+	const Real& fixedTime)
+{
+	error_if(totalMass < 0.001, "Total Mass is too small.");
+
+	const Real forwardSpeed(longitudinalVelocity);
+	const Real slipSpeed(std::max(fabs(forwardSpeed), kMinimumSlipSpeed));
+	const Real steeringAngle(-steeringPosition * mSpecification->mMaximumSteeringAngle); //Counter-clockwise, to the left.
+	const Real baseStiffness(mSpecification->mCorneringStiffness / slipSpeed);
+
+	//Each tire pushes against the sideways speed of its corner in the direction the wheel points,
+	//  F_i = -K * (vy + x_i * r - u * steer_i)   with  K = C / |u|  until the force reaches the grip of the ground,
+	//where the tire slides at the grip instead. Tires past the grip are held there and the rest solved again, once
+	//for each corner at most, like the ground contacts of the RacecarBody.
+	alignas(kCornerAlignment) CornerValues steeringVelocities;
+	alignas(kCornerAlignment) CornerValues gripForces;
+	alignas(kCornerAlignment) CornerValues slidingForces;
+	alignas(kCornerAlignment) CornerValues stiffnesses;
+	for (size_t cornerIndex(0); cornerIndex < kNumberOfCorners; ++cornerIndex)
+	{
+		steeringVelocities[cornerIndex] = forwardSpeed * steeringAngle * mSteeringShares[cornerIndex];
+		const bool hasContact(normalLoads[cornerIndex] > 0.0);
+		gripForces[cornerIndex] = (false == hasContact) ? 0.0 : (gripLimits[cornerIndex] < 0.0) ?
+			std::numeric_limits<Real>::max() : gripLimits[cornerIndex] * normalLoads[cornerIndex];
+		slidingForces[cornerIndex] = 0.0;
+		stiffnesses[cornerIndex] = (true == hasContact) ? baseStiffness : 0.0;
+	}
+
+	const Real inverseMass(1.0 / totalMass);
+	const Real inverseYawInertia(1.0 / mSpecification->mYawInertia);
+	const Real lateralVelocity(mLateralVelocity);
+	const Real yawRate(mYawRate);
+
+	for (size_t pass(0); pass <= kNumberOfCorners; ++pass)
+	{
+		Real sumStiffness(0.0);      //sum(K)
+		Real sumMoment(0.0);         //sum(K * x)
+		Real sumSecondMoment(0.0);   //sum(K * x^2)
+		Real fixedForce(0.0);        //sum(K * u * steer + sliding force)
+		Real fixedYawMoment(0.0);    //sum(x * (K * u * steer + sliding force))
+		for (size_t cornerIndex(0); cornerIndex < kNumberOfCorners; ++cornerIndex)
+		{
+			const Real stiffness(stiffnesses[cornerIndex]);
+			const Real position(mCornerPositions[cornerIndex]);
+			const Real force(stiffness * steeringVelocities[cornerIndex] + slidingForces[cornerIndex]);
+			sumStiffness += stiffness;
+			sumMoment += stiffness * position;
+			sumSecondMoment += stiffness * position * position;
+			fixedForce += force;
+			fixedYawMoment += position * force;
+		}
+
+		//  m * (vy' - vy) / dt = -K0 * vy' - K1 * r' + B0 - m * u * r'
+		//  I * (r' - r) / dt   = -K1 * vy' - K2 * r' + B1
+		const Real a11(1.0 + fixedTime * sumStiffness * inverseMass);
+		const Real a12(fixedTime * (sumMoment * inverseMass + forwardSpeed));
+		const Real a21(fixedTime * sumMoment * inverseYawInertia);
+		const Real a22(1.0 + fixedTime * sumSecondMoment * inverseYawInertia);
+		const Real b1(lateralVelocity + fixedTime * fixedForce * inverseMass);
+		const Real b2(yawRate + fixedTime * fixedYawMoment * inverseYawInertia);
+		const Real determinant(a11 * a22 - a12 * a21);
+		error_if(fabs(determinant) < kEpsilon, "PlanarDynamics cannot solve the lateral motion, the racecar is spinning out of control.");
+
+		mLateralVelocity = (b1 * a22 - a12 * b2) / determinant;
+		mYawRate = (a11 * b2 - a21 * b1) / determinant;
+
+		bool isSolved(true);
+		for (size_t cornerIndex(0); cornerIndex < kNumberOfCorners; ++cornerIndex)
+		{
+			const Real force(slidingForces[cornerIndex] - stiffnesses[cornerIndex] * (mLateralVelocity +
+				mCornerPositions[cornerIndex] * mYawRate - steeringVelocities[cornerIndex]));
+			mLateralForces[cornerIndex] = force;
+			if (fabs(force) > gripForces[cornerIndex])
+			{
+				slidingForces[cornerIndex] = gripForces[cornerIndex] * Racecar::Sign(force);
+				stiffnesses[cornerIndex] = 0.0;
+				isSolved = false;
+			}
+		}
+
+		if (true == isSolved)
+		{
+			break;
+		}
+	}
+
+	Real steeringDrag(0.0);
+	const Real steeringSine(std::sin(steeringAngle));
+	for (size_t cornerIndex(0); cornerIndex < kNumberOfCorners; ++cornerIndex)
+	{
+		steeringDrag += mLateralForces[cornerIndex] * mSteeringShares[cornerIndex] * steeringSine;
+	}
+
+	//The body turns beneath the lateral velocity, and the steered tires pull back against the forward speed.
+	longitudinalVelocity += fixedTime * (mLateralVelocity * mYawRate - steeringDrag * inverseMass);
+
+	mHeading += fixedTime * mYawRate;
+	const Real cosine(std::cos(mHeading));
+	const Real sine(std::sin(mHeading));
+	mPositionX += fixedTime * (longitudinalVelocity * cosine - mLateralVelocity * sine);
+	mPositionY += fixedTime * (longitudinalVelocity * sine + mLateralVelocity * cosine);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
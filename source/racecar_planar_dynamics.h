@@ -0,0 +1,120 @@
+///
+/// @file
+/// @details The motion of the racecar across the ground in the plane, with the sideways slip and yaw of the body from
+///   the lateral force of each tire as the front wheels are steered.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#ifndef _Racecar_PlanarDynamics_h_
+#define _Racecar_PlanarDynamics_h_
+
+#include "racecar.h"
+
+#include <array>
+#include <memory>
+
+namespace Racecar
+{
+
+	///
+	/// @details The geometry, yaw inertia, steering and tire stiffness of the racecar in the plane, which do not change
+	///   while simulating.
+	///
+	struct PlanarDynamicsSpecification
+	{
+		///
+		/// @param yawInertia The moment of inertia of the whole racecar about the vertical axis, in kg-m^2.
+		/// @param frontWeightFraction The share of the weight on the front wheels, which places the center of mass.
+		/// @param maximumSteeringAngle The angle of the front wheels at full steering lock, in radians.
+		/// @param corneringStiffness The lateral force of each tire for each radian of slip angle, in Newtons / radian.
+		///
+		explicit PlanarDynamicsSpecification(const Real& yawInertia, const Real& wheelbase, const Real& frontWeightFraction,
+			const Real& maximumSteeringAngle, const Real& corneringStiffness);
+
+		Real mYawInertia;            //kg-m^2
+		Real mWheelbase;             //meters between the front and rear axles
+		Real mFrontWeightFraction;
+		Real mMaximumSteeringAngle;  //radians
+		Real mCorneringStiffness;    //Newtons / radian at each tire
+	};
+
+	///
+	/// @details Keeps the position, heading, lateral velocity and yaw rate of the racecar, while the forward speed stays
+	///   with the RacecarBody and the longitudinal drive-train. Each tire makes a lateral force from the slip angle of
+	///   its corner, up to the grip of the ground, with the corners indexed as the wheels of the RacecarBody:
+	///     0 front left, 1 front right, 2 rear left, 3 rear right.
+	///   Only the front wheels steer, and the two wheels of an axle sit on the center line of the racecar for the slip
+	///   angle, so the cost of a step is a few loops over the four corners and at most five 2x2 solves.
+	///
+	class PlanarDynamics
+	{
+	public:
+		static const size_t kNumberOfCorners = 4;
+		static constexpr Real kMinimumSlipSpeed = 1.0; //meters / second, keeps the slip angle finite near a standstill.
+
+		explicit PlanarDynamics(const std::shared_ptr<const PlanarDynamicsSpecification>& specification);
+
+		inline const std::shared_ptr<const PlanarDynamicsSpecification>& GetSpecification(void) const { return mSpecification; }
+
+		///
+		/// @details Moves the racecar in the plane for the time step. With the slip angle  (vy + x * r) / u - steer  of
+		///   each corner the lateral velocity and yaw rate are linear in themselves, and are integrated implicitly so
+		///   the stiff tires near a standstill settle rather than oscillate. A tire that would pass the grip of the
+		///   ground slides at the grip instead. The forward speed is changed by the drag of the steered tires and
+		///   the yaw of the body.
+		///
+		/// @param longitudinalVelocity The forward speed of the racecar in meters / second, changed by the step.
+		/// @param steeringPosition From -1 for full lock left to 1 for full lock right.
+		/// @param normalLoads The load on each corner in Newtons, a corner without load such as a missing or airborne
+		///   wheel has no lateral force at all.
+		/// @param gripLimits The friction coefficient of the ground at each loaded corner, less than 0 for infinite grip.
+		///
+		void Simulate(Real& longitudinalVelocity, const Real& steeringPosition, const Real& totalMass,
+			const std::array<Real, kNumberOfCorners>& normalLoads, const std::array<Real, kNumberOfCorners>& gripLimits,
+			const Real& fixedTime = Racecar::kFixedTimeStep);
+
+		///
+		/// @details Places the racecar at the position and heading, at rest sideways and without yaw.
+		///
+		void Reset(const Real& positionX = 0.0, const Real& positionY = 0.0, const Real& heading = 0.0);
+
+		inline const Real& GetPositionX(void) const { return mPositionX; }  //meters
+		inline const Real& GetPositionY(void) const { return mPositionY; }  //meters
+		inline const Real& GetHeading(void) const { return mHeading; }      //radians, counter-clockwise from the x axis.
+		inline const Real& GetYawRate(void) const { return mYawRate; }      //radians / second, counter-clockwise.
+
+		///
+		/// @details Returns the velocity of the racecar to the left of the heading, in meters / second.
+		///
+		inline const Real& GetLateralVelocity(void) const { return mLateralVelocity; }
+
+		///
+		/// @details Returns the lateral force of the tire at the corner during the last step, in Newtons to the left.
+		///
+		inline const Real& GetLateralForce(const size_t& cornerIndex) const { return mLateralForces[cornerIndex]; }
+
+		///
+		/// @details Returns how far the axle of the corner is ahead of the center of mass, in meters.
+		///
+		inline const Real& GetCornerPosition(const size_t& cornerIndex) const { return mCornerPositions[cornerIndex]; }
+
+	private:
+		typedef std::array<Real, kNumberOfCorners> CornerValues;
+		static const size_t kCornerAlignment = kNumberOfCorners * sizeof(Real); //Every corner in one vector register.
+
+		std::shared_ptr<const PlanarDynamicsSpecification> mSpecification;
+		alignas(kCornerAlignment) CornerValues mCornerPositions;   //meters ahead of the center of mass.
+		alignas(kCornerAlignment) CornerValues mSteeringShares;    //1 for a steered corner, 0 otherwise.
+		alignas(kCornerAlignment) CornerValues mLateralForces;     //Newtons
+		Real mPositionX;
+		Real mPositionY;
+		Real mHeading;
+		Real mLateralVelocity;
+		Real mYawRate;
+	};
+
+};	/* namespace Racecar */
+
+#endif /* _Racecar_PlanarDynamics_h_ */
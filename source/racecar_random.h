@@ -0,0 +1,50 @@
+///
+/// @file
+/// @details Counter based random numbers, where each value is computed from a seed and an index rather than the
+///   state of a generator, so any number of threads produce the same values regardless of the order they run in.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#ifndef _Racecar_Random_h_
+#define _Racecar_Random_h_
+
+#include "racecar.h"
+
+#include <cstdint>
+
+namespace Racecar
+{
+
+	///
+	/// @details Returns a well mixed 64-bit value for the counter, the same seed and counter always give the same value.
+	///   This is the finalizer of SplitMix64, which passes the common statistical tests for each step of the counter.
+	///
+	inline uint64_t RandomBits(const uint64_t seed, const uint64_t counter)
+	{
+		uint64_t value(seed + (counter + 1) * 0x9E3779B97F4A7C15ull);
+		value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+		value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+		return value ^ (value >> 31);
+	}
+
+	///
+	/// @details Returns a value from 0 up to, but not including, 1 for the counter.
+	///
+	inline Real RandomReal(const uint64_t seed, const uint64_t counter)
+	{
+		return static_cast<Real>(RandomBits(seed, counter) >> 11) * (1.0 / 9007199254740992.0); //53 bits of mantissa.
+	}
+
+	///
+	/// @details Returns a value from minimum up to, but not including, maximum for the counter.
+	///
+	inline Real RandomReal(const uint64_t seed, const uint64_t counter, const Real& minimum, const Real& maximum)
+	{
+		return minimum + (maximum - minimum) * RandomReal(seed, counter);
+	}
+
+};	/* namespace Racecar */
+
+#endif /* _Racecar_Random_h_ */
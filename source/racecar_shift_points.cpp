@@ -0,0 +1,185 @@
+///
+/// @file
+/// @details Computes the engine speed to upshift at in each gear so the wheel force after the shift is greatest, from
+///   a TorqueCurve and the gearing, into a table that can be queried each step.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#include "racecar_shift_points.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <thread>
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::ShiftPointTable::ShiftPointTable(const TorqueCurve& torqueCurve, const std::vector<Real>& gearRatios,
+	const Real& finalDriveRatio, const Real& wheelRadius, const size_t numberOfThreads) :
+	mOverallRatios(),
+	mShiftRPM(),
+	mAnalyticShiftRPM(),
+	mWheelRadius(wheelRadius),
+	mNumberOfForwardGears(gearRatios.size())
+{
+	error_if(false == torqueCurve.IsNormalized(), "ShiftPointTable expects a normalized TorqueCurve.");
+	error_if(mNumberOfForwardGears > TransmissionSpecification::kMaximumForwardGears, "Too many forward gears for Racecar::Gear.");
+	error_if(mWheelRadius <= 0.0 || finalDriveRatio <= 0.0, "Expected a positive wheel radius and final drive ratio.");
+
+	mOverallRatios.fill(0.0);
+	mShiftRPM.fill(std::numeric_limits<Real>::max());
+	mAnalyticShiftRPM.fill(std::numeric_limits<Real>::max());
+	for (size_t gearIndex(1); gearIndex <= mNumberOfForwardGears; ++gearIndex)
+	{
+		mOverallRatios[gearIndex] = gearRatios[gearIndex - 1] * finalDriveRatio;
+		error_if(gearIndex > 1 && mOverallRatios[gearIndex] >= mOverallRatios[gearIndex - 1], "Expected each gear ratio to be lower than the last.");
+		error_if(mOverallRatios[gearIndex] <= 0.0, "Expected positive forward gear ratios.");
+	}
+
+	if (mNumberOfForwardGears < 2)
+	{
+		return;
+	}
+
+	const size_t numberOfShifts(mNumberOfForwardGears - 1);
+	for (size_t gearIndex(1); gearIndex <= numberOfShifts; ++gearIndex)
+	{
+		mAnalyticShiftRPM[gearIndex] = ComputeAnalyticShiftRPM(torqueCurve, gearIndex);
+	}
+
+	//The sweep spans from a little below the analytic shift point up to the maximum engine speed, with the analytic
+	//shift point as the first sample so the sweep can only confirm or improve it.
+	const Real minimumRPM(torqueCurve.GetMinimumRPM());
+	const Real maximumRPM(torqueCurve.GetMaximumRPM());
+	const Real sweepSpan(0.15 * (maximumRPM - minimumRPM));
+	const size_t samplesPerShift(kSweepSamples + 1);
+	std::vector<Real> shiftTimes(numberOfShifts * samplesPerShift);
+
+	const auto getSampleRPM = [&](const size_t gearIndex, const size_t sampleIndex) {
+		const Real lowestRPM(std::max(minimumRPM, mAnalyticShiftRPM[gearIndex] - sweepSpan));
+		return (0 == sampleIndex) ? mAnalyticShiftRPM[gearIndex] :
+			lowestRPM + (maximumRPM - lowestRPM) * (sampleIndex - 1) / static_cast<Real>(kSweepSamples - 1);
+	};
+
+	std::atomic<size_t> nextTask(0);
+	const auto sweepShiftPoints = [&]() {
+		for (size_t taskIndex(nextTask++); taskIndex < shiftTimes.size(); taskIndex = nextTask++)
+		{
+			const size_t gearIndex(1 + taskIndex / samplesPerShift);
+			const size_t sampleIndex(taskIndex % samplesPerShift);
+			shiftTimes[taskIndex] = ComputeShiftTime(torqueCurve, gearIndex, getSampleRPM(gearIndex, sampleIndex),
+				getSampleRPM(gearIndex, 1), maximumRPM);
+		}
+	};
+
+	const size_t threadCount(std::min(shiftTimes.size(), (numberOfThreads > 0) ? numberOfThreads :
+		std::max(static_cast<size_t>(std::thread::hardware_concurrency()), size_t(1))));
+	std::vector<std::thread> threads;
+	for (size_t threadIndex(1); threadIndex < threadCount; ++threadIndex)
+	{
+		threads.emplace_back(sweepShiftPoints);
+	}
+
+	sweepShiftPoints();
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	for (size_t gearIndex(1); gearIndex <= numberOfShifts; ++gearIndex)
+	{
+		const std::vector<Real>::const_iterator firstSample(shiftTimes.begin() + (gearIndex - 1) * samplesPerShift);
+		const size_t fastestSample(std::min_element(firstSample, firstSample + samplesPerShift) - firstSample);
+		mShiftRPM[gearIndex] = getSampleRPM(gearIndex, fastestSample);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::ShiftPointTable::ComputeAnalyticShiftRPM(const TorqueCurve& torqueCurve, const size_t gearIndex) const
+{
+	//After the shift the engine speed drops by the step between the ratios, so the wheel forces cross where
+	//  T(rpm) * r  =  T(rpm * rNext / r) * rNext   and the radius is common to both sides.
+	const Real minimumRPM(torqueCurve.GetMinimumRPM());
+	const Real maximumRPM(torqueCurve.GetMaximumRPM());
+	const Real ratio(mOverallRatios[gearIndex]);
+	const Real nextRatio(mOverallRatios[gearIndex + 1]);
+	const Real ratioStep(nextRatio / ratio);
+
+	std::array<Real, kAnalyticResolution> engineSpeeds;
+	std::array<Real, kAnalyticResolution> nextEngineSpeeds;
+	for (size_t index(0); index < kAnalyticResolution; ++index)
+	{
+		engineSpeeds[index] = minimumRPM + (maximumRPM - minimumRPM) * index / static_cast<Real>(kAnalyticResolution - 1);
+		nextEngineSpeeds[index] = engineSpeeds[index] * ratioStep;
+	}
+
+	std::array<Real, kAnalyticResolution> torques;
+	std::array<Real, kAnalyticResolution> nextTorques;
+	torqueCurve.GetOutputTorques(engineSpeeds.data(), torques.data(), kAnalyticResolution);
+	torqueCurve.GetOutputTorques(nextEngineSpeeds.data(), nextTorques.data(), kAnalyticResolution);
+
+	//Shifting is only considered once the engine would stay within the curve after the shift.
+	Real previousDifference(0.0);
+	bool hasPrevious(false);
+	for (size_t index(0); index < kAnalyticResolution; ++index)
+	{
+		if (nextEngineSpeeds[index] < minimumRPM)
+		{
+			continue;
+		}
+
+		const Real difference(torques[index] * ratio - nextTorques[index] * nextRatio);
+		if (difference <= 0.0)
+		{
+			if (false == hasPrevious)
+			{
+				return engineSpeeds[index];
+			}
+
+			const Real percentage(previousDifference / (previousDifference - difference));
+			return engineSpeeds[index - 1] + (engineSpeeds[index] - engineSpeeds[index - 1]) * percentage;
+		}
+
+		previousDifference = difference;
+		hasPrevious = true;
+	}
+
+	//The current gear always pulls harder, so hold it to the maximum engine speed.
+	return maximumRPM;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::ShiftPointTable::ComputeShiftTime(const TorqueCurve& torqueCurve, const size_t gearIndex,
+	const Real& shiftRPM, const Real& lowestShiftRPM, const Real& highestShiftRPM) const
+{
+	//  dt = dv / a   where  a = T * r / radius  per kilogram, integrated over even steps of velocity.
+	const Real ratio(mOverallRatios[gearIndex]);
+	const Real nextRatio(mOverallRatios[gearIndex + 1]);
+	const Real rpmToVelocity(RevolutionsMinuteToRadiansSecond(1.0) * mWheelRadius);
+	const Real startVelocity(lowestShiftRPM * rpmToVelocity / ratio);
+	const Real finalVelocity(highestShiftRPM * rpmToVelocity / ratio);
+	const Real shiftVelocity(shiftRPM * rpmToVelocity / ratio);
+	const Real velocityStep((finalVelocity - startVelocity) / kSweepSteps);
+
+	Real time(0.0);
+	for (size_t step(0); step < kSweepSteps; ++step)
+	{
+		const Real velocity(startVelocity + (step + 0.5) * velocityStep);
+		const Real overallRatio((velocity < shiftVelocity) ? ratio : nextRatio);
+		const Real acceleration(torqueCurve.GetOutputTorque(velocity / rpmToVelocity * overallRatio) * overallRatio / mWheelRadius);
+		if (acceleration <= kEpsilon)
+		{	//The racecar would never reach the final velocity with this shift point.
+			return std::numeric_limits<Real>::max();
+		}
+
+		time += velocityStep / acceleration;
+	}
+
+	return time;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,83 @@
+///
+/// @file
+/// @details Computes the engine speed to upshift at in each gear so the wheel force after the shift is greatest, from
+///   a TorqueCurve and the gearing, into a table that can be queried each step.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#ifndef _Racecar_ShiftPoints_h_
+#define _Racecar_ShiftPoints_h_
+
+#include "racecar.h"
+#include "racecar_engine.h"
+#include "racecar_transmission.h"
+
+#include <array>
+#include <vector>
+
+namespace Racecar
+{
+
+	///
+	/// @details The engine speed to upshift at for each forward gear at full throttle. The shift points are first found
+	///   analytically where the wheel force in the next gear overtakes the wheel force in the current gear, then checked
+	///   by integrating the time to accelerate across the shift for a sweep of shift points around it, which runs in
+	///   parallel. The faster of the analytic and swept shift points is kept. Wheel force is used directly, the time is
+	///   per kilogram of racecar since the mass does not change which shift point is quickest.
+	///
+	class ShiftPointTable
+	{
+	public:
+		static const size_t kNumberOfGears = TransmissionSpecification::kMaximumForwardGears + 1;
+		static const size_t kAnalyticResolution = 256;  //Engine speeds searched for where the wheel forces cross.
+		static const size_t kSweepSamples = 32;         //Shift points integrated for each gear, plus the analytic point.
+		static const size_t kSweepSteps = 512;          //Velocity steps integrated for each shift point.
+
+		///
+		/// @param torqueCurve The full throttle torque curve, must be normalized.
+		/// @param gearRatios The ratio of each forward gear starting from First.
+		/// @param wheelRadius The radius of the driven wheels in meters.
+		/// @param numberOfThreads The threads to sweep the shift points with, 0 for one per hardware thread.
+		///
+		explicit ShiftPointTable(const TorqueCurve& torqueCurve, const std::vector<Real>& gearRatios, const Real& finalDriveRatio,
+			const Real& wheelRadius, const size_t numberOfThreads = 0);
+
+		inline size_t GetNumberOfForwardGears(void) const { return mNumberOfForwardGears; }
+
+		///
+		/// @details Returns the engine speed in revolutions-per-minute to upshift out of the gear at, which is
+		///   std::numeric_limits<Real>::max() for the highest gear as it has no gear to shift into.
+		///
+		inline Real GetShiftRPM(const Gear& gear) const { return mShiftRPM[static_cast<size_t>(gear)]; }
+
+		///
+		/// @details Returns the shift point found analytically, before it was checked against the sweep.
+		///
+		inline Real GetAnalyticShiftRPM(const Gear& gear) const { return mAnalyticShiftRPM[static_cast<size_t>(gear)]; }
+
+		inline bool ShouldUpshift(const Gear& gear, const Real& engineSpeedRPM) const { return engineSpeedRPM >= GetShiftRPM(gear); }
+
+	private:
+		typedef std::array<Real, kNumberOfGears> ShiftTable;
+
+		Real ComputeAnalyticShiftRPM(const TorqueCurve& torqueCurve, const size_t gearIndex) const;
+
+		///
+		/// @details Returns the time per kilogram to accelerate from the speed of the lowest shift point to the speed of
+		///   the highest, shifting from the gear into the next at the shift point.
+		///
+		Real ComputeShiftTime(const TorqueCurve& torqueCurve, const size_t gearIndex, const Real& shiftRPM,
+			const Real& lowestShiftRPM, const Real& highestShiftRPM) const;
+
+		std::array<Real, kNumberOfGears> mOverallRatios; //Indexed by Gear, including the final drive.
+		ShiftTable mShiftRPM;
+		ShiftTable mAnalyticShiftRPM;
+		Real mWheelRadius;
+		size_t mNumberOfForwardGears;
+	};
+
+};	/* namespace Racecar */
+
+#endif /* _Racecar_ShiftPoints_h_ */
@@ -0,0 +1,177 @@
+///
+/// @file
+/// @details Automatically selects the gear of a Transmission from a shift map, so that AI racecars do not need to
+///   operate the shifter themselves.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#include "racecar_shift_scheduler.h"
+#include "racecar_controller.h"
+#include "racecar_shift_points.h"
+
+#include <limits>
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::ShiftMap::ShiftMap(const TransmissionSpecification& transmission, const Real& lightThrottleShiftSpeed,
+	const Real& fullThrottleShiftSpeed, const Real& hysteresis) :
+	mUpshiftSpeeds(),
+	mDownshiftSpeeds(),
+	mNumberOfForwardGears(transmission.GetNumberOfForwardGears())
+{
+	error_if(fullThrottleShiftSpeed <= 0.0, "Expected positive shift speeds.");
+
+	GearSpeeds fullThrottleShiftSpeeds;
+	fullThrottleShiftSpeeds.fill(fullThrottleShiftSpeed);
+	ComputeShiftSpeeds(transmission, lightThrottleShiftSpeed, fullThrottleShiftSpeeds, hysteresis);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::ShiftMap::ShiftMap(const TransmissionSpecification& transmission, const Real& lightThrottleShiftSpeed,
+	const ShiftPointTable& shiftPoints, const Real& hysteresis) :
+	mUpshiftSpeeds(),
+	mDownshiftSpeeds(),
+	mNumberOfForwardGears(transmission.GetNumberOfForwardGears())
+{
+	error_if(shiftPoints.GetNumberOfForwardGears() != mNumberOfForwardGears, "Expected shift points for each forward gear of the transmission.");
+
+	GearSpeeds fullThrottleShiftSpeeds;
+	fullThrottleShiftSpeeds.fill(std::numeric_limits<Real>::max());
+	for (size_t gearIndex(1); gearIndex < mNumberOfForwardGears; ++gearIndex)
+	{
+		fullThrottleShiftSpeeds[gearIndex] = RevolutionsMinuteToRadiansSecond(shiftPoints.GetShiftRPM(static_cast<Gear>(gearIndex)));
+	}
+
+	ComputeShiftSpeeds(transmission, lightThrottleShiftSpeed, fullThrottleShiftSpeeds, hysteresis);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::ShiftMap::ComputeShiftSpeeds(const TransmissionSpecification& transmission, const Real& lightThrottleShiftSpeed,
+	const GearSpeeds& fullThrottleShiftSpeeds, const Real& hysteresis)
+{
+	error_if(lightThrottleShiftSpeed <= 0.0, "Expected positive shift speeds.");
+	error_if(hysteresis < 0.0 || hysteresis >= 1.0, "Expected hysteresis to be from 0 up to 1.");
+
+	//Neutral and any gears the transmission does not have never shift, and neither does the highest gear upshift or
+	//first gear downshift, so those speeds can never be reached.
+	for (std::array<Real, kThrottleResolution>& speeds : mUpshiftSpeeds)
+	{
+		speeds.fill(std::numeric_limits<Real>::max());
+	}
+
+	for (std::array<Real, kThrottleResolution>& speeds : mDownshiftSpeeds)
+	{
+		speeds.fill(-std::numeric_limits<Real>::max());
+	}
+
+	for (size_t throttleIndex(0); throttleIndex < kThrottleResolution; ++throttleIndex)
+	{
+		const Real throttlePosition(throttleIndex / static_cast<Real>(kThrottleResolution - 1));
+
+		for (size_t gearIndex(1); gearIndex < mNumberOfForwardGears; ++gearIndex)
+		{
+			const Real& fullThrottleShiftSpeed(fullThrottleShiftSpeeds[gearIndex]);
+			const Real shiftSpeed(lightThrottleShiftSpeed + (fullThrottleShiftSpeed - lightThrottleShiftSpeed) * throttlePosition);
+			const Real upshiftSpeed(shiftSpeed * transmission.GetGearJoint(static_cast<Gear>(gearIndex)).GetInverseGearRatio());
+			mUpshiftSpeeds[gearIndex][throttleIndex] = upshiftSpeed;
+			mDownshiftSpeeds[gearIndex + 1][throttleIndex] = upshiftSpeed * (1.0 - hysteresis);
+		}
+	}
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Gear Racecar::ShiftMap::ComputeGear(const Gear& currentGear, const float throttlePosition, const Real& outputShaftSpeed) const
+{
+	if (Gear::Neutral == currentGear || Gear::Reverse == currentGear)
+	{
+		return currentGear;
+	}
+
+	const size_t gearIndex(static_cast<size_t>(currentGear));
+	const size_t throttleIndex(GetThrottleIndex(throttlePosition));
+	if (outputShaftSpeed > mUpshiftSpeeds[gearIndex][throttleIndex])
+	{
+		return static_cast<Gear>(gearIndex + 1);
+	}
+
+	if (outputShaftSpeed < mDownshiftSpeeds[gearIndex][throttleIndex])
+	{
+		return static_cast<Gear>(gearIndex - 1);
+	}
+
+	return currentGear;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::ShiftMap::GetUpshiftSpeed(const Gear& gear, const float throttlePosition) const
+{
+	error_if(Gear::Reverse == gear, "ShiftMap does not shift reverse.");
+	return mUpshiftSpeeds[static_cast<size_t>(gear)][GetThrottleIndex(throttlePosition)];
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::ShiftMap::GetDownshiftSpeed(const Gear& gear, const float throttlePosition) const
+{
+	error_if(Gear::Reverse == gear, "ShiftMap does not shift reverse.");
+	return mDownshiftSpeeds[static_cast<size_t>(gear)][GetThrottleIndex(throttlePosition)];
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+size_t Racecar::ShiftMap::GetThrottleIndex(const float throttlePosition)
+{
+	const float clampedThrottle((throttlePosition < 0.0f) ? 0.0f : (1.0f < throttlePosition) ? 1.0f : throttlePosition);
+	return static_cast<size_t>(clampedThrottle * (kThrottleResolution - 1) + 0.5f);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::ShiftScheduler::ShiftScheduler(const std::shared_ptr<const ShiftMap>& shiftMap, Transmission& transmission) :
+	mShiftMap(shiftMap),
+	mTransmission(transmission),
+	mControllerSubscription(kThrottleChannel),
+	mThrottlePosition(0.0f)
+{
+	error_if(nullptr == mShiftMap, "ShiftScheduler expects a shift map.");
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::ShiftScheduler::~ShiftScheduler(void)
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::ShiftScheduler::ControllerChange(const RacecarControllerInterface& racecarController)
+{
+	if (true == mControllerSubscription.ConsumeChanges(racecarController))
+	{
+		mThrottlePosition = racecarController.GetThrottlePosition();
+	}
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::ShiftScheduler::Simulate(const Real& fixedTime)
+{
+	((void)fixedTime);
+
+	const Gear currentGear(mTransmission.GetSelectedGear());
+	const Gear selectedGear(mShiftMap->ComputeGear(currentGear, mThrottlePosition, mTransmission.GetAngularVelocity()));
+	if (selectedGear != currentGear)
+	{
+		mTransmission.SelectGear(selectedGear);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,103 @@
+///
+/// @file
+/// @details Automatically selects the gear of a Transmission from a shift map, so that AI racecars do not need to
+///   operate the shifter themselves.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#ifndef _Racecar_ShiftScheduler_h_
+#define _Racecar_ShiftScheduler_h_
+
+#include "racecar.h"
+#include "racecar_transmission.h"
+
+#include <array>
+#include <memory>
+
+namespace Racecar
+{
+	class RacecarControllerInterface;
+	class ShiftPointTable;
+
+	///
+	/// @details The output shaft speeds at which to shift each gear, indexed by throttle position. The map does not
+	///   change while simulating so a single map can be shared by every racecar using the same transmission.
+	///
+	class ShiftMap
+	{
+	public:
+		static const size_t kThrottleResolution = 11; //Every 10% of throttle.
+		static const size_t kNumberOfGears = TransmissionSpecification::kMaximumForwardGears + 1;
+
+		///
+		/// @details Creates a map that upshifts once the engine reaches a speed that rises with the throttle position,
+		///   and downshifts once the engine would be below that speed by the hysteresis in the gear below.
+		///
+		/// @param lightThrottleShiftSpeed The engine speed to upshift at with no throttle, in radians / second.
+		/// @param fullThrottleShiftSpeed The engine speed to upshift at with full throttle, in radians / second.
+		/// @param hysteresis The fraction, from 0 up to 1, the output speed must fall below an upshift before
+		///   downshifting back, which prevents hunting between two gears.
+		///
+		explicit ShiftMap(const TransmissionSpecification& transmission, const Real& lightThrottleShiftSpeed,
+			const Real& fullThrottleShiftSpeed, const Real& hysteresis = 0.2);
+
+		///
+		/// @details Creates a map that upshifts at full throttle at the shift point of each gear from the table, and at
+		///   lighter throttle at a speed that falls toward the light throttle shift speed.
+		///
+		/// @param shiftPoints Must have been computed for the same forward gears as the transmission.
+		///
+		explicit ShiftMap(const TransmissionSpecification& transmission, const Real& lightThrottleShiftSpeed,
+			const ShiftPointTable& shiftPoints, const Real& hysteresis = 0.2);
+
+		///
+		/// @details Returns the gear to select given the current gear, throttle position and speed of the output shaft in
+		///   radians / second. This is a single table lookup and only ever moves one gear at a time. Neutral and Reverse
+		///   are left alone, the map only shifts between forward gears.
+		///
+		Gear ComputeGear(const Gear& currentGear, const float throttlePosition, const Real& outputShaftSpeed) const;
+
+		Real GetUpshiftSpeed(const Gear& gear, const float throttlePosition) const;
+		Real GetDownshiftSpeed(const Gear& gear, const float throttlePosition) const;
+
+	private:
+		static size_t GetThrottleIndex(const float throttlePosition);
+
+		typedef std::array<Real, kNumberOfGears> GearSpeeds;
+		void ComputeShiftSpeeds(const TransmissionSpecification& transmission, const Real& lightThrottleShiftSpeed,
+			const GearSpeeds& fullThrottleShiftSpeeds, const Real& hysteresis);
+
+		typedef std::array<std::array<Real, kThrottleResolution>, kNumberOfGears> ShiftTable;
+		ShiftTable mUpshiftSpeeds;    //Output shaft radians / second by [gear][throttle].
+		ShiftTable mDownshiftSpeeds;  //Output shaft radians / second by [gear][throttle].
+		size_t mNumberOfForwardGears;
+	};
+
+	///
+	/// @details Drives the selected gear of a Transmission from a ShiftMap, the throttle position is read from the
+	///   controller and the transmission is shifted as needed each step, before the drive-train is simulated. The
+	///   manual shift controls should not be used on a transmission with a shift scheduler.
+	///
+	class ShiftScheduler
+	{
+	public:
+		explicit ShiftScheduler(const std::shared_ptr<const ShiftMap>& shiftMap, Transmission& transmission);
+		~ShiftScheduler(void);
+
+		inline const std::shared_ptr<const ShiftMap>& GetShiftMap(void) const { return mShiftMap; }
+
+		void ControllerChange(const RacecarControllerInterface& racecarController);
+		void Simulate(const Real& fixedTime = Racecar::kFixedTimeStep);
+
+	private:
+		std::shared_ptr<const ShiftMap> mShiftMap;
+		Transmission& mTransmission;
+		ControllerSubscription mControllerSubscription;
+		float mThrottlePosition;
+	};
+
+};	/* namespace Racecar */
+
+#endif /* _Racecar_ShiftScheduler_h_ */
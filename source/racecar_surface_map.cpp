@@ -0,0 +1,209 @@
+///
+/// @file
+/// @details A tiled grid of the friction and surface type of the ground around a track, in a compact file layout
+///   that can be read into memory or mapped in place, so the wheels can find the ground beneath them each step.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#include "racecar_surface_map.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+
+namespace
+{
+	static_assert(2 == sizeof(Racecar::SurfaceCell), "SurfaceCell is expected to be two bytes in the file.");
+	static_assert(32 == sizeof(Racecar::SurfaceMap::SurfaceMapHeader), "SurfaceMapHeader is expected to be 32 bytes in the file.");
+
+	const uint32_t kMaximumTileShift(8);
+
+	///
+	/// @details Returns the number of cells in the map, throwing if the cells on a side do not fit in a uint32_t or
+	///   if the file would be too large to address.
+	///
+	size_t ComputeNumberOfCells(const uint32_t tilesWide, const uint32_t tilesHigh, const uint32_t tileShift)
+	{
+		error_if(0 == tilesWide || 0 == tilesHigh, "SurfaceMap expects at least one tile.");
+		error_if(tileShift > kMaximumTileShift, "SurfaceMap tiles are too large.");
+		error_if(tilesWide > (std::numeric_limits<uint32_t>::max() >> tileShift) ||
+			tilesHigh > (std::numeric_limits<uint32_t>::max() >> tileShift), "SurfaceMap has too many cells on a side.");
+
+		const size_t cellsWide(static_cast<size_t>(tilesWide) << tileShift);
+		const size_t cellsHigh(static_cast<size_t>(tilesHigh) << tileShift);
+		const size_t maximumCells((std::numeric_limits<size_t>::max() - sizeof(Racecar::SurfaceMap::SurfaceMapHeader)) /
+			sizeof(Racecar::SurfaceCell));
+		error_if(cellsHigh > maximumCells / cellsWide, "SurfaceMap has too many cells to address.");
+		return cellsWide * cellsHigh;
+	}
+};
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::SurfaceCell Racecar::SurfaceCell::FromFrictionCoefficient(const Real& frictionCoefficient, const SurfaceType surfaceType)
+{
+	SurfaceCell cell;
+	cell.mFriction = (frictionCoefficient < 0.0) ? kInfiniteFriction :
+		static_cast<uint8_t>(std::min(std::round(frictionCoefficient * 100.0), Real(kInfiniteFriction - 1)));
+	cell.mSurfaceType = surfaceType;
+	return cell;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::SurfaceMap::TileCursor::TileCursor(void) :
+	mTile(nullptr),
+	mTileX(-1),
+	mTileY(-1)
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::SurfaceMap::SurfaceMap(const uint32_t tilesWide, const uint32_t tilesHigh, const uint32_t tileShift,
+	const Real& cellSize, const Real& originX, const Real& originY, const SurfaceCell& defaultCell) :
+	mFileData(),
+	mHeader(nullptr),
+	mCells(nullptr),
+	mInverseCellSize(0.0),
+	mCellsPerTile(0),
+	mTileMask(0)
+{
+	const size_t numberOfCells(ComputeNumberOfCells(tilesWide, tilesHigh, tileShift));
+	mFileData.resize(sizeof(SurfaceMapHeader) + numberOfCells * sizeof(SurfaceCell));
+
+	SurfaceMapHeader header;
+	header.mFileIdentifier = kFileIdentifier;
+	header.mTilesWide = tilesWide;
+	header.mTilesHigh = tilesHigh;
+	header.mTileShift = tileShift;
+	header.mCellSize = static_cast<float>(cellSize);
+	header.mOriginX = static_cast<float>(originX);
+	header.mOriginY = static_cast<float>(originY);
+	header.mOutsideCell = defaultCell;
+	header.mReserved = 0;
+	memcpy(mFileData.data(), &header, sizeof(SurfaceMapHeader));
+
+	SurfaceCell* cells(reinterpret_cast<SurfaceCell*>(mFileData.data() + sizeof(SurfaceMapHeader)));
+	std::fill(cells, cells + numberOfCells, defaultCell);
+	Initialize(mFileData.data(), mFileData.size());
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::SurfaceMap::SurfaceMap(const uint8_t* fileData, const size_t fileSize) :
+	mFileData(),
+	mHeader(nullptr),
+	mCells(nullptr),
+	mInverseCellSize(0.0),
+	mCellsPerTile(0),
+	mTileMask(0)
+{
+	Initialize(fileData, fileSize);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::SurfaceMap::SurfaceMap(std::vector<uint8_t>&& fileData) :
+	mFileData(std::move(fileData)),
+	mHeader(nullptr),
+	mCells(nullptr),
+	mInverseCellSize(0.0),
+	mCellsPerTile(0),
+	mTileMask(0)
+{
+	Initialize(mFileData.data(), mFileData.size());
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::SurfaceMap::Initialize(const uint8_t* fileData, const size_t fileSize)
+{
+	error_if(nullptr == fileData || fileSize < sizeof(SurfaceMapHeader), "SurfaceMap file is too small for the header.");
+	error_if(0 != reinterpret_cast<uintptr_t>(fileData) % alignof(SurfaceMapHeader), "SurfaceMap file data is not aligned.");
+
+	mHeader = reinterpret_cast<const SurfaceMapHeader*>(fileData);
+	error_if(kFileIdentifier != mHeader->mFileIdentifier, "SurfaceMap file is not a surface map.");
+	error_if(mHeader->mCellSize <= 0.0f, "SurfaceMap expects a positive cell size.");
+
+	//The header is checked before any size is computed from it, so a damaged file cannot wrap the sizes around.
+	const size_t numberOfCells(ComputeNumberOfCells(mHeader->mTilesWide, mHeader->mTilesHigh, mHeader->mTileShift));
+	error_if((fileSize - sizeof(SurfaceMapHeader)) / sizeof(SurfaceCell) < numberOfCells, "SurfaceMap file is too small for the cells.");
+	mCellsPerTile = size_t(1) << (2 * mHeader->mTileShift);
+
+	mCells = reinterpret_cast<const SurfaceCell*>(fileData + sizeof(SurfaceMapHeader));
+	mInverseCellSize = 1.0 / mHeader->mCellSize;
+	mTileMask = (int64_t(1) << mHeader->mTileShift) - 1;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+std::unique_ptr<Racecar::SurfaceMap> Racecar::SurfaceMap::LoadFromFile(const std::string& filePath)
+{
+	std::ifstream inFile(filePath, std::ios::binary);
+	error_if(false == inFile.is_open(), "SurfaceMap could not open the file.");
+
+	std::vector<uint8_t> fileData((std::istreambuf_iterator<char>(inFile)), std::istreambuf_iterator<char>());
+	return std::unique_ptr<SurfaceMap>(new SurfaceMap(std::move(fileData)));
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::SurfaceMap::SaveToFile(const std::string& filePath) const
+{
+	const size_t numberOfCells(ComputeNumberOfCells(mHeader->mTilesWide, mHeader->mTilesHigh, mHeader->mTileShift));
+	std::ofstream outFile(filePath, std::ios::binary);
+	error_if(false == outFile.is_open(), "SurfaceMap could not create the file.");
+	outFile.write(reinterpret_cast<const char*>(mHeader), sizeof(SurfaceMapHeader));
+	outFile.write(reinterpret_cast<const char*>(mCells), numberOfCells * sizeof(SurfaceCell));
+	error_if(false == outFile.good(), "SurfaceMap could not write the file.");
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+const Racecar::SurfaceCell& Racecar::SurfaceMap::GetCell(const Real& positionX, const Real& positionY, TileCursor& cursor) const
+{
+	const Real cellPositionX(std::floor((positionX - mHeader->mOriginX) * mInverseCellSize));
+	const Real cellPositionY(std::floor((positionY - mHeader->mOriginY) * mInverseCellSize));
+	if (cellPositionX < 0.0 || cellPositionY < 0.0 || cellPositionX >= GetCellsWide() || cellPositionY >= GetCellsHigh())
+	{
+		return mHeader->mOutsideCell;
+	}
+
+	const int64_t cellX(static_cast<int64_t>(cellPositionX));
+	const int64_t cellY(static_cast<int64_t>(cellPositionY));
+	const int64_t tileX(cellX >> mHeader->mTileShift);
+	const int64_t tileY(cellY >> mHeader->mTileShift);
+	if (tileX != cursor.mTileX || tileY != cursor.mTileY || nullptr == cursor.mTile)
+	{
+		cursor.mTile = mCells + static_cast<size_t>(tileY * mHeader->mTilesWide + tileX) * mCellsPerTile;
+		cursor.mTileX = tileX;
+		cursor.mTileY = tileY;
+	}
+
+	return cursor.mTile[((cellY & mTileMask) << mHeader->mTileShift) + (cellX & mTileMask)];
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::SurfaceMap::SetCell(const uint32_t cellX, const uint32_t cellY, const SurfaceCell& cell)
+{
+	error_if(true == mFileData.empty(), "SurfaceMap can only change the cells it owns.");
+	error_if(cellX >= GetCellsWide() || cellY >= GetCellsHigh(), "SurfaceMap cell is beyond the edges of the map.");
+
+	const size_t tileIndex(static_cast<size_t>(cellY >> mHeader->mTileShift) * mHeader->mTilesWide + (cellX >> mHeader->mTileShift));
+	const size_t cellIndex(((cellY & mTileMask) << mHeader->mTileShift) + (cellX & mTileMask));
+	SurfaceCell* cells(reinterpret_cast<SurfaceCell*>(mFileData.data() + sizeof(SurfaceMapHeader)));
+	cells[tileIndex * mCellsPerTile + cellIndex] = cell;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,138 @@
+///
+/// @file
+/// @details A tiled grid of the friction and surface type of the ground around a track, in a compact file layout
+///   that can be read into memory or mapped in place, so the wheels can find the ground beneath them each step.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#ifndef _Racecar_SurfaceMap_h_
+#define _Racecar_SurfaceMap_h_
+
+#include "racecar.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Racecar
+{
+
+	enum class SurfaceType : uint8_t
+	{
+		Tarmac,
+		Curb,
+		Grass,
+		Gravel,
+		Sand,
+		Wall,
+	};
+
+	///
+	/// @details The ground of a single cell of the map, two bytes so a tile of cells is small and contiguous.
+	///
+	struct SurfaceCell
+	{
+		static const uint8_t kInfiniteFriction = 255;
+
+		uint8_t mFriction;     //Hundredths of the friction coefficient, or kInfiniteFriction.
+		SurfaceType mSurfaceType;
+
+		inline Real GetFrictionCoefficient(void) const { return (kInfiniteFriction == mFriction) ? -1.0 : mFriction * 0.01; }
+		inline SurfaceType GetSurfaceType(void) const { return mSurfaceType; }
+
+		///
+		/// @details Returns the cell for the friction coefficient, rounded to the nearest hundredth from 0.0 to 2.54,
+		///   or infinite friction for less than 0 as Wheel::SetOnGround().
+		///
+		static SurfaceCell FromFrictionCoefficient(const Real& frictionCoefficient, const SurfaceType surfaceType);
+	};
+
+	///
+	/// @details The cells of the map are grouped into square tiles, each stored contiguously after a fixed header:
+	///     SurfaceMapHeader, then tilesHigh rows of tilesWide tiles, each tile (1 << tileShift)^2 cells row by row.
+	///   Every field is stored little-endian at its natural alignment, so the file can be used directly from memory.
+	///   The map owns a copy of the file when created or loaded, or views memory owned elsewhere, such as a file mapped
+	///   into memory by the game, so even the largest tracks need not be copied.
+	///
+	class SurfaceMap
+	{
+	public:
+		static const uint32_t kFileIdentifier = 0x314D5352; //"RSM1"
+
+		struct SurfaceMapHeader
+		{
+			uint32_t mFileIdentifier;
+			uint32_t mTilesWide;
+			uint32_t mTilesHigh;
+			uint32_t mTileShift;      //Each tile is (1 << mTileShift) cells on each side.
+			float mCellSize;          //meters
+			float mOriginX;           //meters, the corner of the first cell.
+			float mOriginY;           //meters
+			SurfaceCell mOutsideCell; //The ground beyond the edges of the map.
+			uint16_t mReserved;
+		};
+
+		///
+		/// @details Remembers the last tile a query landed in, so the next query in the same tile skips finding it.
+		///   Each wheel should keep its own cursor, as a cursor is not safe to share between threads.
+		///
+		struct TileCursor
+		{
+			TileCursor(void);
+
+			const SurfaceCell* mTile;
+			int64_t mTileX;
+			int64_t mTileY;
+		};
+
+		///
+		/// @details Creates a map with every cell set to the default cell, to be filled by SetCell().
+		///
+		explicit SurfaceMap(const uint32_t tilesWide, const uint32_t tilesHigh, const uint32_t tileShift, const Real& cellSize,
+			const Real& originX, const Real& originY, const SurfaceCell& defaultCell);
+
+		///
+		/// @details Views the map in memory that must outlive the SurfaceMap, nothing is copied.
+		///
+		explicit SurfaceMap(const uint8_t* fileData, const size_t fileSize);
+
+		SurfaceMap(const SurfaceMap& other) = delete;
+		SurfaceMap& operator=(const SurfaceMap& other) = delete;
+
+		static std::unique_ptr<SurfaceMap> LoadFromFile(const std::string& filePath);
+		void SaveToFile(const std::string& filePath) const;
+
+		///
+		/// @details Returns the cell beneath the position, or the outside cell beyond the edges of the map. This does
+		///   not allocate and takes the same time anywhere on the map.
+		///
+		const SurfaceCell& GetCell(const Real& positionX, const Real& positionY, TileCursor& cursor) const;
+
+		///
+		/// @note Only a map that owns its cells can be changed.
+		///
+		void SetCell(const uint32_t cellX, const uint32_t cellY, const SurfaceCell& cell);
+
+		inline const SurfaceMapHeader& GetHeader(void) const { return *mHeader; }
+		inline uint32_t GetCellsWide(void) const { return mHeader->mTilesWide << mHeader->mTileShift; }
+		inline uint32_t GetCellsHigh(void) const { return mHeader->mTilesHigh << mHeader->mTileShift; }
+
+	private:
+		explicit SurfaceMap(std::vector<uint8_t>&& fileData);
+
+		void Initialize(const uint8_t* fileData, const size_t fileSize);
+
+		std::vector<uint8_t> mFileData;  //Empty while viewing memory owned elsewhere.
+		const SurfaceMapHeader* mHeader;
+		const SurfaceCell* mCells;
+		Real mInverseCellSize;
+		size_t mCellsPerTile;
+		int64_t mTileMask;
+	};
+
+};	/* namespace Racecar */
+
+#endif /* _Racecar_SurfaceMap_h_ */
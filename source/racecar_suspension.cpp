@@ -0,0 +1,88 @@
+///
+/// @file
+/// @details A quarter-car spring and damper at each corner of the racecar, which moves the weight of the racecar
+///   between the front and rear wheels as it accelerates and brakes.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#include "racecar_suspension.h"
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::SuspensionSpecification::SuspensionSpecification(const Real& springRate, const Real& dampingRate,
+	const Real& centerOfMassHeight, const Real& wheelbase, const Real& frontWeightFraction) :
+	mSpringRate(springRate),
+	mDampingRate(dampingRate),
+	mCenterOfMassHeight(centerOfMassHeight),
+	mWheelbase(wheelbase),
+	mFrontWeightFraction(frontWeightFraction)
+{
+	error_if(mSpringRate <= 0.0 || mDampingRate < 0.0, "Expected a positive spring rate and a damping rate that is not negative.");
+	error_if(mWheelbase <= 0.0 || mCenterOfMassHeight < 0.0, "Expected a positive wheelbase and center of mass height.");
+	error_if(mFrontWeightFraction < 0.0 || mFrontWeightFraction > 1.0, "Expected the front weight fraction from 0 to 1.");
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Suspension::Suspension(const std::shared_ptr<const SuspensionSpecification>& specification) :
+	mSpecification(specification),
+	mWeightShares(),
+	mTransferShares(),
+	mDeflections(),
+	mDeflectionVelocities(),
+	mNormalLoads()
+{
+	error_if(nullptr == mSpecification, "Suspension expects a specification.");
+
+	const Real frontShare(0.5 * mSpecification->mFrontWeightFraction);
+	const Real rearShare(0.5 - frontShare);
+	const Real transferShare(0.5 * mSpecification->mCenterOfMassHeight / mSpecification->mWheelbase);
+	mWeightShares = CornerValues{ { frontShare, frontShare, rearShare, rearShare } };
+	mTransferShares = CornerValues{ { -transferShare, -transferShare, transferShare, transferShare } };
+	Reset();
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::Suspension::Reset(void)
+{
+	mDeflections.fill(0.0);
+	mDeflectionVelocities.fill(0.0);
+	mNormalLoads.fill(0.0);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::Suspension::Simulate(const Real& longitudinalAcceleration, const Real& totalMass, const Real& fixedTime)
+{
+	//The arguments are copied, as references they could alias the corners and be loaded again for each corner.
+	const Real mass(totalMass);
+	const Real timeStep(fixedTime);
+	const Real springRate(mSpecification->mSpringRate);
+	const Real dampingRate(mSpecification->mDampingRate);
+	const Real weight(Racecar::GetGravityConstant() * mass);
+	const Real transferLoad(mass * longitudinalAcceleration);
+	const Real stiffness(timeStep * dampingRate + timeStep * timeStep * springRate);
+
+	//Each corner is measured from the rest position under the static load, so only the load transfer drives it. The
+	//  lifted corner is clamped with a select rather than a branch so the corners stay one vector.
+	for (size_t cornerIndex(0); cornerIndex < kNumberOfCorners; ++cornerIndex)
+	{
+		const Real sprungMass(mass * mWeightShares[cornerIndex]);
+		const Real transferForce(transferLoad * mTransferShares[cornerIndex]);
+		const Real deflectionVelocity((sprungMass * mDeflectionVelocities[cornerIndex] +
+			timeStep * (transferForce - springRate * mDeflections[cornerIndex])) / (sprungMass + stiffness));
+		const Real deflection(mDeflections[cornerIndex] + timeStep * deflectionVelocity);
+		const Real normalLoad(weight * mWeightShares[cornerIndex] + springRate * deflection + dampingRate * deflectionVelocity);
+
+		mDeflectionVelocities[cornerIndex] = deflectionVelocity;
+		mDeflections[cornerIndex] = deflection;
+		mNormalLoads[cornerIndex] = (normalLoad > 0.0) ? normalLoad : 0.0;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,96 @@
+///
+/// @file
+/// @details A quarter-car spring and damper at each corner of the racecar, which moves the weight of the racecar
+///   between the front and rear wheels as it accelerates and brakes.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#ifndef _Racecar_Suspension_h_
+#define _Racecar_Suspension_h_
+
+#include "racecar.h"
+
+#include <array>
+#include <memory>
+
+namespace Racecar
+{
+
+	///
+	/// @details The springs, dampers and geometry of the suspension which do not change while simulating, every corner
+	///   uses the same spring and damper.
+	///
+	struct SuspensionSpecification
+	{
+		///
+		/// @param frontWeightFraction The share of the weight on the front wheels while at rest, 0.5 for even.
+		///
+		explicit SuspensionSpecification(const Real& springRate, const Real& dampingRate, const Real& centerOfMassHeight,
+			const Real& wheelbase, const Real& frontWeightFraction = 0.5);
+
+		Real mSpringRate;           //Newtons / meter at each corner
+		Real mDampingRate;          //Newton-seconds / meter at each corner
+		Real mCenterOfMassHeight;   //meters above the ground
+		Real mWheelbase;            //meters between the front and rear axles
+		Real mFrontWeightFraction;
+	};
+
+	///
+	/// @details Each corner carries its share of the racecar as a sprung mass on a spring and damper, driven by the
+	///   longitudinal load transfer  m * a * h / L  split across the two wheels of each axle. The four corners are
+	///   kept side by side and updated together in a single loop without branches, so the compiler can update them
+	///   as one vector when vectorizing loops (-O3). The corners are indexed as the wheels of the RacecarBody:
+	///     0 front left, 1 front right, 2 rear left, 3 rear right.
+	///
+	class Suspension
+	{
+	public:
+		static const size_t kNumberOfCorners = 4;
+
+		explicit Suspension(const std::shared_ptr<const SuspensionSpecification>& specification);
+
+		inline const std::shared_ptr<const SuspensionSpecification>& GetSpecification(void) const { return mSpecification; }
+
+		///
+		/// @details Moves every corner for the time step. The spring and damper are integrated implicitly,
+		///     v' = (m * v + dt * (F - k * x)) / (m + dt * c + dt^2 * k)    x' = x + dt * v'
+		///   so a stiff spring settles at the fixed time step instead of gaining energy each step.
+		///
+		/// @param longitudinalAcceleration The acceleration of the racecar, in meters / second^2, forwards positive.
+		/// @param totalMass The mass resting on the suspension, in kilograms.
+		///
+		void Simulate(const Real& longitudinalAcceleration, const Real& totalMass, const Real& fixedTime = Racecar::kFixedTimeStep);
+
+		///
+		/// @details Returns every corner to the rest position, without any load transfer.
+		///
+		void Reset(void);
+
+		///
+		/// @details Returns the load the corner pushes the wheel into the ground with, in Newtons, which is never
+		///   negative as a wheel can lift but cannot pull the racecar down.
+		///
+		inline const Real& GetNormalLoad(const size_t& cornerIndex) const { return mNormalLoads[cornerIndex]; }
+
+		///
+		/// @details Returns how far the corner is compressed beyond the rest position, in meters.
+		///
+		inline const Real& GetDeflection(const size_t& cornerIndex) const { return mDeflections[cornerIndex]; }
+
+	private:
+		typedef std::array<Real, kNumberOfCorners> CornerValues;
+		static const size_t kCornerAlignment = kNumberOfCorners * sizeof(Real); //Every corner in one vector register.
+
+		std::shared_ptr<const SuspensionSpecification> mSpecification;
+		alignas(kCornerAlignment) CornerValues mWeightShares;         //The share of the total mass at each corner at rest.
+		alignas(kCornerAlignment) CornerValues mTransferShares;       //The share of the load transfer, negative at the front.
+		alignas(kCornerAlignment) CornerValues mDeflections;          //meters
+		alignas(kCornerAlignment) CornerValues mDeflectionVelocities; //meters / second
+		alignas(kCornerAlignment) CornerValues mNormalLoads;          //Newtons
+	};
+
+};	/* namespace Racecar */
+
+#endif /* _Racecar_Suspension_h_ */
@@ -0,0 +1,149 @@
+///
+/// @file
+/// @details A longitudinal tire model that follows the Pacejka Magic Formula through a lookup table built once for
+///   each tire, so finding the force of a tire while simulating is a table lookup and a lerp.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#include "racecar_tire_model.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace
+{
+	const Racecar::Real kSlipRatioPerSample(2.0 * Racecar::TireSpecification::kMaximumSlipRatio /
+		static_cast<Racecar::Real>(Racecar::TireSpecification::kTableResolution - 1));
+	const Racecar::Real kSamplesPerSlipRatio(1.0 / kSlipRatioPerSample);
+	const Racecar::Real kLastTableIndex(static_cast<Racecar::Real>(Racecar::TireSpecification::kTableResolution - 2));
+	const int32_t kLastBatchIndex(static_cast<int32_t>(Racecar::TireSpecification::kTableResolution - 2));
+};
+
+constexpr Racecar::Real Racecar::TireSpecification::kMaximumSlipRatio;
+constexpr Racecar::Real Racecar::TireSpecification::kMinimumSlipSpeed;
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::TireSpecification::TireSpecification(void) :
+	TireSpecification(10.0, 1.9, 1.0, 0.97)
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::TireSpecification::TireSpecification(const Real& stiffnessFactor, const Real& shapeFactor,
+	const Real& peakFrictionCoefficient, const Real& curvatureFactor) :
+	mStiffnessFactor(stiffnessFactor),
+	mShapeFactor(shapeFactor),
+	mPeakFrictionCoefficient(peakFrictionCoefficient),
+	mCurvatureFactor(curvatureFactor),
+	mFrictionTable()
+{
+	error_if(mStiffnessFactor <= 0.0 || mShapeFactor <= 0.0 || mPeakFrictionCoefficient <= 0.0,
+		"TireSpecification expects positive stiffness, shape and peak friction.");
+
+	for (size_t sampleIndex(0); sampleIndex < kTableResolution; ++sampleIndex)
+	{
+		const Real slipRatio(-kMaximumSlipRatio + sampleIndex * kSlipRatioPerSample);
+		const Real stiffSlip(mStiffnessFactor * slipRatio);
+		mFrictionTable[sampleIndex] = mPeakFrictionCoefficient *
+			std::sin(mShapeFactor * std::atan(stiffSlip - mCurvatureFactor * (stiffSlip - std::atan(stiffSlip))));
+	}
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::TireSpecification::ComputeSlipRatio(const Real& wheelSurfaceSpeed, const Real& linearVelocity)
+{
+	return (wheelSurfaceSpeed - linearVelocity) / std::max(fabs(linearVelocity), kMinimumSlipSpeed);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::TireSpecification::GetFrictionCoefficient(const Real& slipRatio) const
+{
+	const Real clampedSlipRatio(std::min(std::max(slipRatio, -kMaximumSlipRatio), kMaximumSlipRatio));
+	const Real position((clampedSlipRatio + kMaximumSlipRatio) * kSamplesPerSlipRatio);
+	const Real tableIndex(std::min(std::floor(position), kLastTableIndex));
+	const size_t index(static_cast<size_t>(tableIndex));
+	const Real percentage(position - tableIndex);
+	return mFrictionTable[index] + (mFrictionTable[index + 1] - mFrictionTable[index]) * percentage;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::TireSpecification::GetFrictionCoefficient(const Real& slipRatio, Real& frictionSlope) const
+{
+	const Real clampedSlipRatio(std::min(std::max(slipRatio, -kMaximumSlipRatio), kMaximumSlipRatio));
+	const Real position((clampedSlipRatio + kMaximumSlipRatio) * kSamplesPerSlipRatio);
+	const Real tableIndex(std::min(std::floor(position), kLastTableIndex));
+	const size_t index(static_cast<size_t>(tableIndex));
+	const Real percentage(position - tableIndex);
+	const Real sampleDifference(mFrictionTable[index + 1] - mFrictionTable[index]);
+
+	frictionSlope = (fabs(slipRatio) > kMaximumSlipRatio) ? 0.0 : sampleDifference * kSamplesPerSlipRatio;
+	return mFrictionTable[index] + sampleDifference * percentage;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::TireSpecification::ComputeContactImpulse(const Real& slipVelocity, const Real& linearVelocity,
+	const Real& normalLoad, const Real& inverseEffectiveMass, const Real& fixedTime) const
+{
+	//The slip ratio is the slip velocity over the slip speed, so  dF/dv = N * dmu/dk / slipSpeed  which grows without
+	//bound as the slip speed falls, and is what makes an explicit step overshoot. Past the peak the slope is negative,
+	//which is left explicit as it would otherwise weaken the denominator.
+	const Real slipSpeed(std::max(fabs(linearVelocity), kMinimumSlipSpeed));
+	Real frictionSlope(0.0);
+	const Real frictionCoefficient(GetFrictionCoefficient(slipVelocity / slipSpeed, frictionSlope));
+	const Real forceSlope(std::max(frictionSlope, Real(0.0)) * normalLoad / slipSpeed);
+
+	const Real contactImpulse(frictionCoefficient * normalLoad * fixedTime / (1.0 + fixedTime * inverseEffectiveMass * forceSlope));
+	const Real matchingImpulse(slipVelocity / inverseEffectiveMass);
+	return (fabs(contactImpulse) < fabs(matchingImpulse)) ? contactImpulse : matchingImpulse;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::TireSpecification::ComputeContactImpulses(const Real* slipVelocities, const Real* normalLoads,
+	const Real* inverseEffectiveMasses, Real* __restrict contactImpulses, const size_t count, const Real& linearVelocity,
+	const Real& fixedTime) const
+{
+	//The same as ComputeContactImpulse() for each tire, with every select written on values so it becomes a blend.
+	//  The slip velocity is clamped to the table by the slip speed, clamping the slip ratio to the constant ends of
+	//  the table had the compiler split the loop into a branch for each end. The clamped position is never negative,
+	//  so truncating it is the floor without std::floor(), which is not vectorized unless the math may be relaxed.
+	//  The slope keeps only the rising part of the sample difference, and is zeroed beyond the table through the load
+	//  it scales, since selecting a constant slope was also turned back into a branch.
+	const Real* const frictionTable(mFrictionTable.data());
+	const Real slipSpeed(std::max(fabs(linearVelocity), kMinimumSlipSpeed));
+	const Real maximumSlipVelocity(kMaximumSlipRatio * slipSpeed);
+	const Real timeStep(fixedTime);
+	for (size_t tireIndex(0); tireIndex < count; ++tireIndex)
+	{
+		const Real slipVelocity(slipVelocities[tireIndex]);
+		const Real normalLoad(normalLoads[tireIndex]);
+		const Real inverseEffectiveMass(inverseEffectiveMasses[tireIndex]);
+		const Real clampedSlipVelocity((slipVelocity < -maximumSlipVelocity) ? -maximumSlipVelocity :
+			(slipVelocity > maximumSlipVelocity) ? maximumSlipVelocity : slipVelocity);
+
+		const Real position((clampedSlipVelocity / slipSpeed + kMaximumSlipRatio) * kSamplesPerSlipRatio);
+		const int32_t truncatedIndex(static_cast<int32_t>(position));
+		const int32_t index((truncatedIndex < kLastBatchIndex) ? truncatedIndex : kLastBatchIndex);
+		const Real percentage(position - static_cast<Real>(index));
+		const Real sampleDifference(frictionTable[index + 1] - frictionTable[index]);
+		const Real frictionCoefficient(frictionTable[index] + sampleDifference * percentage);
+		const Real risingDifference((sampleDifference + fabs(sampleDifference)) * 0.5);
+		const Real slopeLoad((fabs(slipVelocity / slipSpeed) > kMaximumSlipRatio) ? 0.0 : normalLoad);
+		const Real forceSlope(risingDifference * kSamplesPerSlipRatio * slopeLoad / slipSpeed);
+
+		const Real contactImpulse(frictionCoefficient * normalLoad * timeStep / (1.0 + timeStep * inverseEffectiveMass * forceSlope));
+		const Real matchingImpulse(slipVelocity / inverseEffectiveMass);
+		contactImpulses[tireIndex] = (fabs(contactImpulse) < fabs(matchingImpulse)) ? contactImpulse : matchingImpulse;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
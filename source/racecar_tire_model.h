@@ -0,0 +1,96 @@
+///
+/// @file
+/// @details A longitudinal tire model that follows the Pacejka Magic Formula through a lookup table built once for
+///   each tire, so finding the force of a tire while simulating is a table lookup and a lerp.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#ifndef _Racecar_TireModel_h_
+#define _Racecar_TireModel_h_
+
+#include "racecar.h"
+
+#include <array>
+
+namespace Racecar
+{
+
+	///
+	/// @details The Magic Formula coefficients of a tire, where the friction coefficient at a slip ratio k is
+	///   D * sin(C * atan(B*k - E*(B*k - atan(B*k))))   sampled uniformly from -kMaximumSlipRatio to kMaximumSlipRatio
+	///   when the specification is created, slip ratios beyond that use the friction at the end of the table. A single
+	///   specification can be shared by every tire of the same model.
+	///
+	struct TireSpecification
+	{
+		static const size_t kTableResolution = 256;
+		static constexpr Real kMaximumSlipRatio = 1.0;     //A locked wheel, and a wheel spinning twice as fast as it rolls.
+		static constexpr Real kMinimumSlipSpeed = 0.5;     //meters / second, keeps the slip ratio finite near a standstill.
+
+		///
+		/// @details Creates a tire with the coefficients of a typical road tire on dry tarmac.
+		///
+		TireSpecification(void);
+
+		///
+		/// @param stiffnessFactor B, how quickly the force rises with slip.
+		/// @param shapeFactor C, how much the force falls after the peak.
+		/// @param peakFrictionCoefficient D, the most friction the tire can make.
+		/// @param curvatureFactor E, how sharp the peak is.
+		///
+		explicit TireSpecification(const Real& stiffnessFactor, const Real& shapeFactor, const Real& peakFrictionCoefficient,
+			const Real& curvatureFactor);
+
+		///
+		/// @details Returns the slip ratio of a wheel, positive while the wheel turns faster than it rolls.
+		///
+		/// @param wheelSurfaceSpeed The angular velocity of the wheel multiplied by the radius, in meters / second.
+		/// @param linearVelocity The speed of the wheel over the ground, in meters / second.
+		///
+		static Real ComputeSlipRatio(const Real& wheelSurfaceSpeed, const Real& linearVelocity);
+
+		///
+		/// @details Returns the friction coefficient of the tire at the slip ratio, the longitudinal force is this
+		///   multiplied by the normal load.
+		///
+		Real GetFrictionCoefficient(const Real& slipRatio) const;
+
+		///
+		/// @details Returns the friction coefficient at the slip ratio, and the slope of the table where it was found as
+		///   the change in friction coefficient for each unit of slip ratio, which is zero beyond the table.
+		///
+		Real GetFrictionCoefficient(const Real& slipRatio, Real& frictionSlope) const;
+
+		///
+		/// @details Returns the impulse, in Newton-seconds, the tire applies against the slip during the time step. The
+		///   slope of the force is taken implicitly,  J = F * dt / (1 + dt * k * dF/dv)  where v is the slip velocity,
+		///   so the stiff response of the tire near a standstill settles the slip instead of oscillating around zero.
+		///   The impulse never passes the one that would bring the slip to zero.
+		///
+		/// @param slipVelocity The surface speed of the wheel minus the linear velocity, in meters / second.
+		/// @param inverseEffectiveMass k, the change in slip velocity from each Newton-second of impulse.
+		///
+		Real ComputeContactImpulse(const Real& slipVelocity, const Real& linearVelocity, const Real& normalLoad,
+			const Real& inverseEffectiveMass, const Real& fixedTime) const;
+
+		///
+		/// @details Computes the impulse of each tire as ComputeContactImpulse() would, for tires rolling at the same
+		///   linear velocity such as all the wheels of a racecar, written to be vectorized by the compiler.
+		///
+		/// @param contactImpulses An array of count values to be filled, which must not overlap the inputs.
+		///
+		void ComputeContactImpulses(const Real* slipVelocities, const Real* normalLoads, const Real* inverseEffectiveMasses,
+			Real* __restrict contactImpulses, const size_t count, const Real& linearVelocity, const Real& fixedTime) const;
+
+		Real mStiffnessFactor;          //B
+		Real mShapeFactor;              //C
+		Real mPeakFrictionCoefficient;  //D
+		Real mCurvatureFactor;          //E
+		std::array<Real, kTableResolution> mFrictionTable;
+	};
+
+};	/* namespace Racecar */
+
+#endif /* _Racecar_TireModel_h_ */
@@ -0,0 +1,193 @@
+///
+/// @file
+/// @details The elevation and curvature of a track sampled evenly along its length, which can be read from a file a
+///   window at a time so even the longest tracks do not need to be held in memory.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#include "racecar_track_profile.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+	static_assert(8 == sizeof(Racecar::TrackSample), "TrackSample is expected to be eight bytes in the file.");
+	static_assert(16 == sizeof(Racecar::TrackProfile::TrackProfileHeader), "TrackProfileHeader is expected to be 16 bytes in the file.");
+};
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::TrackProfile::TrackProfile(void) :
+	mHeader(),
+	mSamples(),
+	mFile(),
+	mWindow(nullptr),
+	mWindowStart(0),
+	mWindowCount(0),
+	mInverseSampleSpacing(0.0)
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::TrackProfile::TrackProfile(const std::vector<TrackSample>& samples, const Real& sampleSpacing) :
+	TrackProfile()
+{
+	mSamples = samples;
+	mWindow = mSamples.data();
+	mWindowCount = mSamples.size();
+
+	TrackProfileHeader header;
+	header.mFileIdentifier = kFileIdentifier;
+	header.mNumberOfSamples = static_cast<uint32_t>(samples.size());
+	header.mSampleSpacing = static_cast<float>(sampleSpacing);
+	header.mReserved = 0;
+	Initialize(header);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::TrackProfile::TrackProfile(const uint8_t* fileData, const size_t fileSize) :
+	TrackProfile()
+{
+	error_if(nullptr == fileData || fileSize < sizeof(TrackProfileHeader), "TrackProfile file is too small for the header.");
+	error_if(0 != reinterpret_cast<uintptr_t>(fileData) % alignof(TrackSample), "TrackProfile file data is not aligned.");
+
+	TrackProfileHeader header;
+	memcpy(&header, fileData, sizeof(TrackProfileHeader));
+	error_if(fileSize < sizeof(TrackProfileHeader) + header.mNumberOfSamples * sizeof(TrackSample), "TrackProfile file is too small for the samples.");
+
+	mWindow = reinterpret_cast<const TrackSample*>(fileData + sizeof(TrackProfileHeader));
+	mWindowCount = header.mNumberOfSamples;
+	Initialize(header);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::TrackProfile::Initialize(const TrackProfileHeader& header)
+{
+	error_if(kFileIdentifier != header.mFileIdentifier, "TrackProfile file is not a track profile.");
+	error_if(header.mNumberOfSamples < 2, "TrackProfile expects at least two samples.");
+	error_if(header.mSampleSpacing <= 0.0f, "TrackProfile expects a positive sample spacing.");
+
+	mHeader = header;
+	mInverseSampleSpacing = 1.0 / mHeader.mSampleSpacing;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+std::unique_ptr<Racecar::TrackProfile> Racecar::TrackProfile::OpenFile(const std::string& filePath)
+{
+	std::unique_ptr<TrackProfile> trackProfile(new TrackProfile());
+	trackProfile->mFile.open(filePath, std::ios::binary);
+	error_if(false == trackProfile->mFile.is_open(), "TrackProfile could not open the file.");
+
+	TrackProfileHeader header;
+	trackProfile->mFile.read(reinterpret_cast<char*>(&header), sizeof(TrackProfileHeader));
+	error_if(false == trackProfile->mFile.good(), "TrackProfile file is too small for the header.");
+	trackProfile->Initialize(header);
+
+	//The window is allocated once, and reused for every read after.
+	trackProfile->mSamples.resize(std::min(size_t(kWindowSamples), trackProfile->GetNumberOfSamples()));
+	trackProfile->mWindow = trackProfile->mSamples.data();
+	trackProfile->LoadWindow(0);
+	return trackProfile;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::TrackProfile::SaveToFile(const std::string& filePath)
+{
+	std::ofstream outFile(filePath, std::ios::binary);
+	error_if(false == outFile.is_open(), "TrackProfile could not create the file.");
+	outFile.write(reinterpret_cast<const char*>(&mHeader), sizeof(TrackProfileHeader));
+
+	//Written a window at a time, so a streamed profile can be copied without holding every sample.
+	size_t sampleIndex(0);
+	while (sampleIndex < GetNumberOfSamples())
+	{
+		if (sampleIndex < mWindowStart || sampleIndex >= mWindowStart + mWindowCount)
+		{
+			LoadWindow(sampleIndex);
+		}
+
+		const size_t samplesToWrite(mWindowStart + mWindowCount - sampleIndex);
+		outFile.write(reinterpret_cast<const char*>(mWindow + sampleIndex - mWindowStart), samplesToWrite * sizeof(TrackSample));
+		sampleIndex += samplesToWrite;
+	}
+
+	error_if(false == outFile.good(), "TrackProfile could not write the file.");
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::TrackProfile::LoadWindow(const size_t sampleIndex)
+{
+	error_if(false == mFile.is_open(), "TrackProfile expected the samples to be in memory.");
+
+	//A quarter of the window is kept behind the sample, for a racecar backing up over the edge of the window.
+	const size_t windowSize(mSamples.size());
+	mWindowStart = std::min(sampleIndex - std::min(sampleIndex, windowSize / 4), GetNumberOfSamples() - windowSize);
+	mWindowCount = windowSize;
+
+	mFile.clear();
+	mFile.seekg(sizeof(TrackProfileHeader) + mWindowStart * sizeof(TrackSample), std::ios::beg);
+	mFile.read(reinterpret_cast<char*>(mSamples.data()), mWindowCount * sizeof(TrackSample));
+	error_if(false == mFile.good(), "TrackProfile file is too small for the samples.");
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+size_t Racecar::TrackProfile::FindSegment(const Real& distance, Real& percentage)
+{
+	const Real lastSegment(static_cast<Real>(GetNumberOfSamples() - 2));
+	const Real position(std::min(std::max(distance * mInverseSampleSpacing, Real(0.0)), lastSegment + 1.0));
+	const Real segment(std::min(std::floor(position), lastSegment));
+	const size_t sampleIndex(static_cast<size_t>(segment));
+	percentage = position - segment;
+
+	if (sampleIndex < mWindowStart || sampleIndex + 1 >= mWindowStart + mWindowCount)
+	{
+		LoadWindow(sampleIndex);
+	}
+
+	return sampleIndex - mWindowStart;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::TrackProfile::GetElevation(const Real& distance)
+{
+	Real percentage(0.0);
+	const size_t windowIndex(FindSegment(distance, percentage));
+	return mWindow[windowIndex].mElevation + (mWindow[windowIndex + 1].mElevation - mWindow[windowIndex].mElevation) * percentage;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::TrackProfile::GetGrade(const Real& distance)
+{
+	if (distance < 0.0 || distance > GetLength())
+	{
+		return 0.0;
+	}
+
+	Real percentage(0.0);
+	const size_t windowIndex(FindSegment(distance, percentage));
+	return (mWindow[windowIndex + 1].mElevation - mWindow[windowIndex].mElevation) * mInverseSampleSpacing;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::TrackProfile::GetCurvature(const Real& distance)
+{
+	Real percentage(0.0);
+	const size_t windowIndex(FindSegment(distance, percentage));
+	return mWindow[windowIndex].mCurvature + (mWindow[windowIndex + 1].mCurvature - mWindow[windowIndex].mCurvature) * percentage;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,121 @@
+///
+/// @file
+/// @details The elevation and curvature of a track sampled evenly along its length, which can be read from a file a
+///   window at a time so even the longest tracks do not need to be held in memory.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#ifndef _Racecar_TrackProfile_h_
+#define _Racecar_TrackProfile_h_
+
+#include "racecar.h"
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Racecar
+{
+
+	///
+	/// @details The track at a single distance along it, eight bytes so a window of samples is small.
+	///
+	struct TrackSample
+	{
+		float mElevation;  //meters
+		float mCurvature;  //1 / meters, positive turning left.
+	};
+
+	///
+	/// @details The file is a fixed header followed by every sample in order of distance:
+	///     TrackProfileHeader, then mNumberOfSamples TrackSamples, the first at a distance of 0.
+	///   Every field is stored little-endian at its natural alignment, so the file can be used directly from memory.
+	///   The profile owns the samples when created from them, views memory owned elsewhere, such as a file mapped into
+	///   memory by the game, or streams the samples from the file a window at a time when opened. Distances before the
+	///   start or beyond the end of the track take the first or last sample, which is flat.
+	///
+	/// @note A streamed profile reads the file as the lookups move, so it is not safe to share between threads.
+	///
+	class TrackProfile
+	{
+	public:
+		static const uint32_t kFileIdentifier = 0x31505452; //"RTP1"
+		static const size_t kWindowSamples = 4096;          //Samples read from the file at a time, 32KB.
+
+		struct TrackProfileHeader
+		{
+			uint32_t mFileIdentifier;
+			uint32_t mNumberOfSamples;
+			float mSampleSpacing;    //meters between samples
+			uint32_t mReserved;
+		};
+
+		///
+		/// @param sampleSpacing The distance between each of the samples, in meters.
+		///
+		explicit TrackProfile(const std::vector<TrackSample>& samples, const Real& sampleSpacing);
+
+		///
+		/// @details Views the profile in memory that must outlive the TrackProfile, nothing is copied.
+		///
+		explicit TrackProfile(const uint8_t* fileData, const size_t fileSize);
+
+		TrackProfile(const TrackProfile& other) = delete;
+		TrackProfile& operator=(const TrackProfile& other) = delete;
+
+		///
+		/// @details Opens the file to stream the samples from, only a window of the samples is held in memory.
+		///
+		static std::unique_ptr<TrackProfile> OpenFile(const std::string& filePath);
+		void SaveToFile(const std::string& filePath);
+
+		///
+		/// @details Returns the elevation of the track at the distance in meters, between the nearest samples.
+		///
+		Real GetElevation(const Real& distance);
+
+		///
+		/// @details Returns the rise of the track for each meter along it at the distance, which is the slope between
+		///   the nearest samples, positive uphill.
+		///
+		Real GetGrade(const Real& distance);
+
+		///
+		/// @details Returns the curvature of the track at the distance in 1 / meters, between the nearest samples.
+		///
+		Real GetCurvature(const Real& distance);
+
+		inline size_t GetNumberOfSamples(void) const { return mHeader.mNumberOfSamples; }
+		inline Real GetSampleSpacing(void) const { return mHeader.mSampleSpacing; }
+		inline Real GetLength(void) const { return (GetNumberOfSamples() - 1) * GetSampleSpacing(); }
+
+	private:
+		TrackProfile(void);
+
+		void Initialize(const TrackProfileHeader& header);
+
+		///
+		/// @details Finds the sample at or before the distance and how far it is to the next, making sure both samples
+		///   are in the window. A streamed profile reads a new window from the file once the distance leaves it, which
+		///   is a single read of a fixed size, so each lookup takes the same time wherever it is on the track.
+		///
+		size_t FindSegment(const Real& distance, Real& percentage);
+
+		void LoadWindow(const size_t sampleIndex);
+
+		TrackProfileHeader mHeader;
+		std::vector<TrackSample> mSamples;  //Every sample when owned, or the window when streamed.
+		std::ifstream mFile;                //Only open while streamed.
+		const TrackSample* mWindow;
+		size_t mWindowStart;
+		size_t mWindowCount;
+		Real mInverseSampleSpacing;
+	};
+
+};	/* namespace Racecar */
+
+#endif /* _Racecar_TrackProfile_h_ */
@@ -1,6 +1,6 @@
 ///
 /// @file
-/// @details This is a basic simulation for a 5 speed h-shifter transmission.
+/// @details This is a basic simulation for a transmission with any number of forward gears, up to ten, and reverse.
 ///
 /// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
 /// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
@@ -9,28 +9,102 @@
 #include "racecar_transmission.h"
 #include "racecar_controller.h"
 
-#include "racecar_clutch.h" //For the ClutchJoint to perform a frictional synchromesh.
+namespace
+{
+	const Racecar::Real kSynchromeshNormalForce(10.0);         //N
+	const Racecar::Real kSynchromeshFrictionCoefficient(0.45);
+
+	///
+	/// @details Returns the next gear up, which stops at the highest forward gear of the transmission.
+	///
+	Racecar::Gear UpshiftGear(const Racecar::Gear& gear, const Racecar::TransmissionSpecification& specification)
+	{
+		if (Racecar::Gear::Reverse == gear)
+		{
+			return Racecar::Gear::Neutral;
+		}
+
+		const size_t nextGear(static_cast<size_t>(gear) + 1);
+		return (nextGear > specification.GetNumberOfForwardGears()) ? gear : static_cast<Racecar::Gear>(nextGear);
+	}
+
+	///
+	/// @details Returns the next gear down, from Neutral into Reverse when the transmission has a reverse gear.
+	///
+	Racecar::Gear DownshiftGear(const Racecar::Gear& gear, const Racecar::TransmissionSpecification& specification)
+	{
+		if (Racecar::Gear::Reverse == gear)
+		{
+			return Racecar::Gear::Reverse;
+		}
+
+		if (Racecar::Gear::Neutral == gear)
+		{
+			return (true == specification.HasReverseGear()) ? Racecar::Gear::Reverse : Racecar::Gear::Neutral;
+		}
 
+		return static_cast<Racecar::Gear>(static_cast<size_t>(gear) - 1);
+	}
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
 //--------------------------------------------------------------------------------------------------------------------//
 
-constexpr Racecar::Gear UpshiftGear(const Racecar::Gear& gear)
+Racecar::TransmissionSpecification::TransmissionSpecification(const Real momentOfInertia,
+	const std::vector<Real>& forwardGearRatios, const Real& reverseRatio) :
+	RotatingBodySpecification(momentOfInertia),
+	mIsSynchromeshBox(false),
+	mSynchromeshFrictionCoefficient(kSynchromeshFrictionCoefficient),
+	mNumberOfForwardGears(forwardGearRatios.size()),
+	mGearJoints()
 {
-	return
-		(Racecar::Gear::Reverse == gear) ? Racecar::Gear::Neutral :
-		(Racecar::Gear::Neutral == gear) ? Racecar::Gear::First :
-		(Racecar::Gear::First == gear) ? Racecar::Gear::Second :
-		(Racecar::Gear::Second == gear) ? Racecar::Gear::Third :
-		(Racecar::Gear::Third == gear) ? Racecar::Gear::Fourth : Racecar::Gear::Fifth;
+	error_if(mNumberOfForwardGears > kMaximumForwardGears, "Transmission has more forward gears than Racecar::Gear supports.");
+	error_if(reverseRatio > kEpsilon, "Expected reverseRatio to be negative, or zero for no reverse gear.");
+
+	mGearJoints.reserve(mNumberOfForwardGears + 1);
+	for (const Real& gearRatio : forwardGearRatios)
+	{
+		mGearJoints.emplace_back(gearRatio);
+	}
+
+	if (reverseRatio < -kEpsilon)
+	{
+		mGearJoints.emplace_back(reverseRatio);
+	}
 }
 
-constexpr Racecar::Gear DownshiftGear(const Racecar::Gear& gear)
+//--------------------------------------------------------------------------------------------------------------------//
+
+Racecar::TransmissionSpecification::TransmissionSpecification(const Real momentOfInertia,
+	const std::array<Real, 6>& gearRatios, const Real& reverseRatio) :
+	TransmissionSpecification(momentOfInertia, std::vector<Real>(gearRatios.begin(),
+		(fabs(gearRatios[5]) < kEpsilon) ? gearRatios.end() - 1 : gearRatios.end()), reverseRatio)
 {
-	return
-		(Racecar::Gear::Fifth == gear) ? Racecar::Gear::Fourth :
-		(Racecar::Gear::Fourth == gear) ? Racecar::Gear::Third :
-		(Racecar::Gear::Third == gear) ? Racecar::Gear::Second :
-		(Racecar::Gear::Second == gear) ? Racecar::Gear::First :
-		(Racecar::Gear::First == gear) ? Racecar::Gear::Neutral : Racecar::Gear::Reverse;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::TransmissionSpecification::HasGear(const Gear& gear) const
+{
+	return (Gear::Neutral == gear) ? true : (Gear::Reverse == gear) ? HasReverseGear() :
+		static_cast<size_t>(gear) <= mNumberOfForwardGears;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t Racecar::TransmissionSpecification::GetGearIndex(const Gear& gear) const
+{
+	error_if(Gear::Neutral == gear, "Neutral does not have a GearJoint.");
+	error_if(false == HasGear(gear), "Transmission does not have the gear.");
+	return (Gear::Reverse == gear) ? mNumberOfForwardGears : static_cast<size_t>(gear) - 1;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::TransmissionSpecification::SetGearRatio(const Gear& gear, const Real& gearRatio)
+{
+	mGearJoints[GetGearIndex(gear)] = GearJoint(gearRatio);
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -38,15 +112,28 @@ constexpr Racecar::Gear DownshiftGear(const Racecar::Gear& gear)
 //--------------------------------------------------------------------------------------------------------------------//
 
 Racecar::Transmission::Transmission(const Real momentOfInertia, const std::array<Real, 6>& gearRatios, const Real& reverseRatio) :
-	RotatingBody(momentOfInertia),
+	Transmission(std::make_shared<const TransmissionSpecification>(momentOfInertia, gearRatios, reverseRatio))
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Transmission::Transmission(const Real momentOfInertia, const std::vector<Real>& forwardGearRatios, const Real& reverseRatio) :
+	Transmission(std::make_shared<const TransmissionSpecification>(momentOfInertia, forwardGearRatios, reverseRatio))
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Transmission::Transmission(const std::shared_ptr<const TransmissionSpecification>& specification) :
+	RotatingBody(specification, kShifterChannel | kShiftButtonChannel),
+	mSynchromeshJoint(),
 	mSelectedGear(Gear::Neutral),
+	mSelectedGearIndex(0),
 	mHasClearedShift(true),
-	mIsSynchromeshBox(false),
-	mHasUsedShifter(false),
-	mGearJoints{ GearJoint(100.0), GearJoint(gearRatios[0]), GearJoint(gearRatios[1]), GearJoint(gearRatios[2]),
-		GearJoint(gearRatios[3]), GearJoint(gearRatios[4]), GearJoint(fabs(gearRatios[5]) < kEpsilon ? 100.0 : gearRatios[5]),
-		GearJoint(reverseRatio > -kEpsilon ? 100.0 : reverseRatio) }
+	mHasUsedShifter(false)
 {
+	mSynchromeshJoint.SetNormalForce(kSynchromeshNormalForce);
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -57,6 +144,13 @@ Racecar::Transmission::~Transmission(void)
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+void Racecar::Transmission::SetSynchromeshBox(const bool synchromeshBox)
+{
+	ModifySpecification(&TransmissionSpecification::mIsSynchromeshBox, synchromeshBox);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 void Racecar::Transmission::OnControllerChange(const RacecarControllerInterface& racecarController)
 {
 	if (racecarController.GetShifterPosition() != Gear::Neutral)
@@ -70,12 +164,12 @@ void Racecar::Transmission::OnControllerChange(const RacecarControllerInterface&
 		{
 			if (true == racecarController.IsUpshift())
 			{	//Upshift
-				mSelectedGear = UpshiftGear(mSelectedGear);
+				SelectGear(UpshiftGear(mSelectedGear, GetTransmissionSpecification()));
 				mHasClearedShift = false;
 			}
 			else if (true == racecarController.IsDownshift())
 			{	//Downshift
-				mSelectedGear = DownshiftGear(mSelectedGear);
+				SelectGear(DownshiftGear(mSelectedGear, GetTransmissionSpecification()));
 				mHasClearedShift = false;
 			}
 		}
@@ -89,12 +183,27 @@ void Racecar::Transmission::OnControllerChange(const RacecarControllerInterface&
 	}
 	else
 	{
-		mSelectedGear = racecarController.GetShifterPosition();
+		SelectGear(racecarController.GetShifterPosition());
 	}
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+void Racecar::Transmission::SelectGear(const Gear& gear)
+{
+	if (Gear::Neutral == gear || false == GetTransmissionSpecification().HasGear(gear))
+	{
+		mSelectedGear = Gear::Neutral;
+		mSelectedGearIndex = 0;
+		return;
+	}
+
+	mSelectedGear = gear;
+	mSelectedGearIndex = GetTransmissionSpecification().GetGearIndex(gear);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 void Racecar::Transmission::OnSimulate(const Real& fixedTime)
 {
 	if (Gear::Neutral == mSelectedGear)
@@ -104,13 +213,12 @@ void Racecar::Transmission::OnSimulate(const Real& fixedTime)
 	else
 	{
 		RotatingBody& inputSource(GetExpectedInputSource());
-		GearJoint& currentGearJoint(mGearJoints[static_cast<size_t>(GetSelectedGear())]);
-		
-		const Real matchImpulse = currentGearJoint.ComputeTorqueImpulse(inputSource, *this);
-		if (true == mIsSynchromeshBox)
+		const TransmissionSpecification& specification(GetTransmissionSpecification());
+		const Real matchImpulse = GetSelectedGearJoint().ComputeTorqueImpulse(inputSource, *this);
+		if (true == specification.mIsSynchromeshBox)
 		{
-			const Real frictionImpulse = 10 * 0.45 * fixedTime;
-			const Real appliedImpulse((fabs(matchImpulse) > frictionImpulse) ? frictionImpulse * Sign(matchImpulse) : matchImpulse);
+			const Real appliedImpulse(mSynchromeshJoint.ComputeFrictionImpulse(matchImpulse,
+				specification.mSynchromeshFrictionCoefficient, specification.mSynchromeshFrictionCoefficient, fixedTime));
 			GetExpectedInputSource().ApplyUpstreamAngularImpulse(appliedImpulse);
 			ApplyDownstreamAngularImpulse(-appliedImpulse);
 		}
@@ -138,8 +246,14 @@ Racecar::Real Racecar::Transmission::ComputeDownstreamInertia(void) const
 	//return RotatingBody::ComputeDownstreamInertia() / fabs(GetSelectedGearRatio());
 
 	//https://www.servo2go.com/support/files/Smart%20Motion%20Cheat%20Sheet%20Rev3.pdf
-	const Real oneOverRatioSquared((1 / GetSelectedGearRatio()) * (1 / GetSelectedGearRatio()));
-	return RotatingBody::ComputeDownstreamInertia() * oneOverRatioSquared;
+	return RotatingBody::ComputeDownstreamInertia() * GetSelectedGearJoint().GetInverseGearRatioSquared();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::Transmission::HasDownstreamLoad(void) const
+{
+	return Gear::Neutral != mSelectedGear && RotatingBody::HasDownstreamLoad();
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -155,8 +269,7 @@ Racecar::Real Racecar::Transmission::ComputeUpstreamInertia(void) const
 
 	const RotatingBody* inputSource(GetInputSource());
 	const Real upstreamInertia((nullptr == inputSource) ? 0.0 : inputSource->ComputeUpstreamInertia());
-	const Real ratioSquared(GetSelectedGearRatio() * GetSelectedGearRatio());
-	return GetInertia() + upstreamInertia * ratioSquared;
+	return GetInertia() + upstreamInertia * GetSelectedGearJoint().GetGearRatioSquared();
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -165,7 +278,7 @@ void Racecar::Transmission::OnDownstreamAngularVelocityChange(const Real& change
 {
 	if (Gear::Neutral != mSelectedGear)
 	{
-		RotatingBody::OnDownstreamAngularVelocityChange(changeInAngularVelocity / GetSelectedGearRatio());
+		RotatingBody::OnDownstreamAngularVelocityChange(changeInAngularVelocity * GetSelectedGearJoint().GetInverseGearRatio());
 	}
 }
 
@@ -180,7 +293,7 @@ void Racecar::Transmission::OnUpstreamAngularVelocityChange(const Real& changeIn
 		RotatingBody* inputSource(GetInputSource());
 		if (nullptr != inputSource)
 		{
-			inputSource->OnUpstreamAngularVelocityChange(changeInAngularVelocity * GetSelectedGearRatio());
+			inputSource->OnUpstreamAngularVelocityChange(changeInAngularVelocity * GetSelectedGearJoint().GetGearRatio());
 		}
 	}
 }
@@ -188,7 +301,7 @@ void Racecar::Transmission::OnUpstreamAngularVelocityChange(const Real& changeIn
 Racecar::Real Racecar::Transmission::GetSelectedGearRatio(void) const
 {
 	error_if(Gear::Neutral == mSelectedGear, "Cannot use this while in neutral.");
-	return mGearJoints[static_cast<int>(mSelectedGear)].GetGearRatio();
+	return GetSelectedGearJoint().GetGearRatio();
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -196,7 +309,10 @@ Racecar::Real Racecar::Transmission::GetSelectedGearRatio(void) const
 //--------------------------------------------------------------------------------------------------------------------//
 
 Racecar::GearJoint::GearJoint(Real gearRatio) :
-	mGearRatio(gearRatio)
+	mGearRatio(gearRatio),
+	mInverseGearRatio(1.0 / gearRatio),
+	mGearRatioSquared(gearRatio * gearRatio),
+	mInverseGearRatioSquared(1.0 / (gearRatio * gearRatio))
 {
 	error_if(fabs(mGearRatio) < 0.01, "Error: gearRatio too close to zero.");
 }
@@ -209,7 +325,7 @@ Racecar::GearJoint::~GearJoint(void)
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-Racecar::Real Racecar::GearJoint::ComputeTorqueImpulse(const RotatingBody& input, const RotatingBody& output, const Real& fixedTimeStep)
+Racecar::Real Racecar::GearJoint::ComputeTorqueImpulse(const RotatingBody& input, const RotatingBody& output, const Real& fixedTimeStep) const
 {
 	((void)fixedTimeStep);
 	return ComputeTorqueImpulseToMatchVelocity(input, output);
@@ -217,7 +333,7 @@ Racecar::Real Racecar::GearJoint::ComputeTorqueImpulse(const RotatingBody& input
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-Racecar::Real Racecar::GearJoint::ComputeTorqueImpulseToMatchVelocity(const RotatingBody& input, const RotatingBody& output)
+Racecar::Real Racecar::GearJoint::ComputeTorqueImpulseToMatchVelocity(const RotatingBody& input, const RotatingBody& output) const
 {
 	//   J = (Io * Ii * (Wo * gr - Wi)) / (Io + Ii * gr)
 	//
@@ -236,7 +352,7 @@ Racecar::Real Racecar::GearJoint::ComputeTorqueImpulseToMatchVelocity(const Rota
 	error_if(inputInertia < kEpsilon || outputInertia < kEpsilon, "Expected input and output inertia to be greater than zero.");
 
 	const Real numerator = (inputInertia * outputInertia * Sign(ratio)) * (ratio * output.GetAngularVelocity() - input.GetAngularVelocity()); //Io*Ii*(r*Wo - Wi)
-	const Real denominator = outputInertia + inputInertia * ratio; //Io + Ii * gr
+	const Real denominator = outputInertia + inputInertia * fabs(ratio); //Io + Ii * |gr|, a negative ratio must not reduce this.
 	const Real torqueImpulse = numerator / denominator;
 	return torqueImpulse * Sign(ratio);
 
@@ -1,6 +1,6 @@
 ///
 /// @file
-/// @details This is a basic simulation for a 5 speed h-shifter transmission.
+/// @details This is a basic simulation for a transmission with any number of forward gears, up to ten, and reverse.
 ///
 /// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
 /// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
@@ -10,8 +10,11 @@
 #define _Racecar_Transmission_h_
 
 #include "rotating_body.h"
+#include "racecar_friction_joint.h"
 
 #include <array>
+#include <memory>
+#include <vector>
 
 namespace Racecar
 {
@@ -24,12 +27,23 @@ namespace Racecar
 
 		const Real& GetGearRatio(void) const { return mGearRatio; }
 
-		Real ComputeTorqueImpulse(const RotatingBody& input, const RotatingBody& output, const Real& fixedTimeStep = Racecar::kFixedTimeStep);
+		///
+		/// @details The inverse and squared ratios are computed once when the joint is created so that reflecting
+		///   speeds and inertia through the joint never needs to divide.
+		///
+		const Real& GetInverseGearRatio(void) const { return mInverseGearRatio; }
+		const Real& GetGearRatioSquared(void) const { return mGearRatioSquared; }
+		const Real& GetInverseGearRatioSquared(void) const { return mInverseGearRatioSquared; }
+
+		Real ComputeTorqueImpulse(const RotatingBody& input, const RotatingBody& output, const Real& fixedTimeStep = Racecar::kFixedTimeStep) const;
 
 	private:
-		Real ComputeTorqueImpulseToMatchVelocity(const RotatingBody& input, const RotatingBody& output);
+		Real ComputeTorqueImpulseToMatchVelocity(const RotatingBody& input, const RotatingBody& output) const;
 
-		const Real mGearRatio;
+		Real mGearRatio;
+		Real mInverseGearRatio;
+		Real mGearRatioSquared;
+		Real mInverseGearRatioSquared;
 	};
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -43,24 +57,97 @@ namespace Racecar
 		Fourth,
 		Fifth,
 		Sixth,
+		Seventh,
+		Eighth,
+		Ninth,
+		Tenth,
 		Reverse,
 	};
 
+	///
+	/// @details The gear ratios and inertia of a Transmission which do not change while simulating, a single
+	///   specification can be shared by every transmission of the same model.
+	///
+	struct TransmissionSpecification : public RotatingBodySpecification
+	{
+		static const size_t kMaximumForwardGears = static_cast<size_t>(Gear::Tenth);
+
+		///
+		/// @param forwardGearRatios The ratio of each forward gear starting from First, up to kMaximumForwardGears.
+		/// @param reverseRatio Expected to be negative, or zero for a transmission without a reverse gear.
+		///
+		explicit TransmissionSpecification(const Real momentOfInertia, const std::vector<Real>& forwardGearRatios, const Real& reverseRatio);
+
+		///
+		/// @details Creates a six speed transmission, a sixth ratio of zero creates a five speed transmission instead.
+		///
+		explicit TransmissionSpecification(const Real momentOfInertia, const std::array<Real, 6>& gearRatios, const Real& reverseRatio);
+
+		inline size_t GetNumberOfForwardGears(void) const { return mNumberOfForwardGears; }
+		inline bool HasReverseGear(void) const { return mGearJoints.size() > mNumberOfForwardGears; }
+
+		///
+		/// @details Returns true if the gear exists in this transmission, Neutral always exists.
+		///
+		bool HasGear(const Gear& gear) const;
+
+		///
+		/// @details Returns the index of the gear within mGearJoints, the gear is expected to exist and not be Neutral.
+		///
+		size_t GetGearIndex(const Gear& gear) const;
+		inline const GearJoint& GetGearJoint(const Gear& gear) const { return mGearJoints[GetGearIndex(gear)]; }
+
+		///
+		/// @details Replaces the ratio of a gear the transmission has, without changing the number of gears.
+		///
+		/// @note Transmissions sharing this specification will see the change immediately, so this should only be used
+		///   on a specification that is not shared, or before it is.
+		///
+		void SetGearRatio(const Gear& gear, const Real& gearRatio);
+
+		bool mIsSynchromeshBox;
+		Real mSynchromeshFrictionCoefficient; //Of the synchromesh cones, defaults to 0.45.
+		size_t mNumberOfForwardGears;
+		std::vector<GearJoint> mGearJoints; //Each forward gear from First, followed by Reverse when it exists.
+	};
+
 	class RacecarControllerInterface;
 
 	class Transmission : public RotatingBody
 	{
 	public:
 		explicit Transmission(const Real momentOfInertia, const std::array<Real, 6>& gearRatios, const Real& reverseRatio);
+		explicit Transmission(const Real momentOfInertia, const std::vector<Real>& forwardGearRatios, const Real& reverseRatio);
+
+		///
+		/// @details Creates a transmission that shares the specification with any other transmissions created from it.
+		///
+		explicit Transmission(const std::shared_ptr<const TransmissionSpecification>& specification);
 		virtual ~Transmission(void);
 
+		inline std::shared_ptr<const TransmissionSpecification> GetSpecification(void) const
+		{
+			return GetSharedSpecificationAs<TransmissionSpecification>();
+		}
+
 		const Gear& GetSelectedGear(void) const { return mSelectedGear; }
 		Real GetSelectedGearRatio(void) const;
 
-		void SetSynchromeshBox(const bool synchromeshBox) { mIsSynchromeshBox = synchromeshBox; }
+		///
+		/// @details Changes the selected gear directly, as an automatic transmission or ShiftScheduler would. This will
+		///   be Neutral if the gear does not exist in this transmission.
+		///
+		void SelectGear(const Gear& gear);
+
+		///
+		/// @note This modifies the specification, so a transmission sharing it will receive a copy of its own first, unless
+		///   the value is unchanged.
+		///
+		void SetSynchromeshBox(const bool synchromeshBox);
 
 		virtual Racecar::Real ComputeDownstreamInertia(void) const override;
 		virtual Racecar::Real ComputeUpstreamInertia(void) const override;
+		virtual bool HasDownstreamLoad(void) const override;
 
 	protected:
 		virtual void OnControllerChange(const RacecarControllerInterface& racecarController) override;
@@ -70,11 +157,21 @@ namespace Racecar
 		virtual void OnUpstreamAngularVelocityChange(const Real& changeInAngularVelocity) override;
 
 	private:
+		inline const TransmissionSpecification& GetTransmissionSpecification(void) const
+		{
+			return GetSpecificationAs<TransmissionSpecification>();
+		}
+
+		inline const GearJoint& GetSelectedGearJoint(void) const
+		{
+			return GetTransmissionSpecification().mGearJoints[mSelectedGearIndex];
+		}
+
+		FrictionJoint mSynchromeshJoint;
 		Racecar::Gear mSelectedGear;
+		size_t mSelectedGearIndex;
 		bool mHasClearedShift;
-		bool mIsSynchromeshBox;
 		bool mHasUsedShifter;
-		std::array<GearJoint, 8> mGearJoints;
 	};
 
 };	/* namespace Racecar */
@@ -7,21 +7,45 @@
 ///-----------------------------------------------------------------------------------------------------------------///
 
 #include "racecar_wheel.h"
-#include "racecar_body.h"
 #include "racecar_controller.h"
 
+#include <limits>
+
+namespace
+{
+	const Racecar::Real kBrakeFrictionCoefficient(1.0); //The maximum braking torque already includes the pad friction.
+};
+
 const Racecar::Real Racecar::Wheel::kInfiniteFriction(-1.0);
 
 //-------------------------------------------------------------------------------------------------------------------//
 
-Racecar::Wheel::Wheel(const Real& massInKilograms, const Real& radiusInMeters) :
-	RotatingBody(massInKilograms * (radiusInMeters * radiusInMeters)), //kg-m^2
+Racecar::WheelSpecification::WheelSpecification(const Real& massInKilograms, const Real& radiusInMeters) :
+	RotatingBodySpecification(massInKilograms * (radiusInMeters * radiusInMeters)), //kg-m^2
 	mMass(massInKilograms),
 	mRadius(radiusInMeters),
+	mMaximumBrakingTorque(100.0), //Nm
+	mTire(nullptr)
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Wheel::Wheel(const Real& massInKilograms, const Real& radiusInMeters) :
+	Wheel(std::make_shared<const WheelSpecification>(massInKilograms, radiusInMeters))
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Wheel::Wheel(const std::shared_ptr<const WheelSpecification>& specification) :
+	RotatingBody(specification, kBrakeChannel),
 	mLinearVelocity(0.0),
 	mGroundFrictionCoefficient(-1.0),
-	mMaximumBrakingTorque(100.0), //Nm
 	mBrakePedalPosition(0.0),
+	mBrakeJoint(),
 	mRacecarBody(nullptr),
 	mIsOnGround(false)
 {
@@ -43,6 +67,34 @@ void Racecar::Wheel::SetRacecarBody(RacecarBody* racecarBody)
 
 //-------------------------------------------------------------------------------------------------------------------//
 
+void Racecar::Wheel::SetLinearVelocity(const Real& linearVelocity)
+{
+	if (nullptr != mRacecarBody)
+	{
+		mRacecarBody->SetLinearVelocity(linearVelocity);
+	}
+	else
+	{
+		mLinearVelocity = linearVelocity;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::Wheel::SetMaximumBrakingTorque(const Real& maximumBrakingTorque)
+{
+	ModifySpecification(&WheelSpecification::mMaximumBrakingTorque, maximumBrakingTorque);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::Wheel::SetTire(const std::shared_ptr<const TireSpecification>& tire)
+{
+	ModifySpecification(&WheelSpecification::mTire, tire);
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
 void Racecar::Wheel::OnControllerChange(const RacecarControllerInterface& racecarController)
 {
 	mBrakePedalPosition = racecarController.GetBrakePosition();
@@ -52,23 +104,15 @@ void Racecar::Wheel::OnControllerChange(const RacecarControllerInterface& raceca
 
 void Racecar::Wheel::OnSimulate(const Real& fixedTime)
 {
-	///Compute the impulse it would take to stop the wheel / car + connections, compare that against the
-	///actual impulse that would be applied based on braking torque, use the lower of those values in the
-	///correct direction, and apply the upstream torque to slow the wheel + connections.
-	const Real totalInertia(ComputeUpstreamInertia());
-	const Real maximumImpulse(totalInertia * fabs(GetAngularVelocity())); //kg*m^2 / s    NOTE: TODO: DriveTrain: If the wheel is slipping, this may not be true.
-	const Real actualImpulse(mMaximumBrakingTorque * mBrakePedalPosition * fixedTime); //kg*m^2 / s
-	const Real appliedImpulse((actualImpulse > maximumImpulse) ? maximumImpulse : actualImpulse);
-	if (appliedImpulse > kEpsilon)
+	///A wheel on a racecar body has the brakes and ground contact solved by RacecarBody::Simulate(), after the slope
+	///has pulled on the racecar, otherwise this will slow the car/speed the wheel or speed the car/slow the wheel as
+	///necessary when making contact with the ground, limited by the friction of the ground or tire.
+	if (nullptr == mRacecarBody)
 	{
-		ApplyUpstreamAngularImpulse(appliedImpulse * -Racecar::Sign(GetAngularVelocity()));
+		ApplyBrakes(fixedTime);
+		ApplyGroundFriction(fixedTime);
 	}
 
-	///This is currently assuming an INFINITE amount of friction which will cause the tire never to lock up, and always
-	///match the speed of the racecar, but will slow the car/speed the wheel or speed the car/slow the wheel as necessary
-	///when making contact with the ground that has infinite friction!
-	ApplyGroundFriction(fixedTime);
-
 	RotatingBody::OnSimulate(fixedTime);
 
 	//const RotatingBody* inputSource(GetInputSource());
@@ -82,11 +126,18 @@ void Racecar::Wheel::OnSimulate(const Real& fixedTime)
 
 //-------------------------------------------------------------------------------------------------------------------//
 
+bool Racecar::Wheel::HasDownstreamLoad(void) const
+{
+	return true;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
 Racecar::Real Racecar::Wheel::ComputeDownstreamInertia(void) const
 {
 	if (true == mIsOnGround && nullptr != mRacecarBody)
 	{
-		const Real carInertia((mRacecarBody->GetMass() * mRadius * mRadius));
+		const Real carInertia((mRacecarBody->GetMass() * GetRadius() * GetRadius()));
 		return RotatingBody::ComputeDownstreamInertia() + carInertia;
 	}
 
@@ -99,7 +150,7 @@ Racecar::Real Racecar::Wheel::ComputeUpstreamInertia(void) const
 {
 	if (true == mIsOnGround && nullptr != mRacecarBody)
 	{
-		const Real carInertia((mRacecarBody->GetMass() * mRadius * mRadius));
+		const Real carInertia((mRacecarBody->GetMass() * GetRadius() * GetRadius()));
 		return RotatingBody::ComputeUpstreamInertia() + carInertia;
 	}
 
@@ -108,13 +159,78 @@ Racecar::Real Racecar::Wheel::ComputeUpstreamInertia(void) const
 
 //-------------------------------------------------------------------------------------------------------------------//
 
+Racecar::Real Racecar::Wheel::ComputeContactInertia(void) const
+{
+	return RotatingBody::ComputeUpstreamInertia();
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::Wheel::ComputeTireLoad(const Real& normalLoad) const
+{	//The friction of the surface scales the grip of the tire as if it scaled the load.
+	const Real surfaceCoefficient((mGroundFrictionCoefficient < 0.0) ? 1.0 : mGroundFrictionCoefficient);
+	return surfaceCoefficient * normalLoad;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::Real Racecar::Wheel::ComputeContactImpulseLimit(const Real& slipVelocity, const Real& normalLoad,
+	const Real& inverseEffectiveMass, const Real& fixedTime) const
+{
+	const std::shared_ptr<const TireSpecification>& tire(GetWheelSpecification().mTire);
+	if (nullptr != tire)
+	{
+		return fabs(tire->ComputeContactImpulse(slipVelocity, GetLinearVelocity(),
+			ComputeTireLoad(normalLoad), inverseEffectiveMass, fixedTime));
+	}
+
+	if (mGroundFrictionCoefficient < 0.0)
+	{
+		return std::numeric_limits<Real>::max();
+	}
+
+	return mGroundFrictionCoefficient * normalLoad * fixedTime;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::Wheel::ApplyBrakes(const Real& fixedTime)
+{
+	///Compute the impulse it would take to stop the wheel / car + connections, the brake joint limits that to the
+	///impulse the braking torque can apply, and apply the upstream torque to slow the wheel + connections. The racecar
+	///is stopped by its own momentum, not the speed of the wheel, so the brakes also hold against a slipping wheel.
+	Real stoppingImpulse(ComputeUpstreamInertia() * GetAngularVelocity()); //kg*m^2 / s
+	if (true == mIsOnGround && nullptr != mRacecarBody)
+	{
+		stoppingImpulse = ComputeContactInertia() * GetAngularVelocity() +
+			mRacecarBody->GetMass() * GetRadius() * mRacecarBody->GetLinearVelocity();
+	}
+
+	mBrakeJoint.SetNormalForce(GetWheelSpecification().mMaximumBrakingTorque * mBrakePedalPosition);
+	const Real appliedImpulse(mBrakeJoint.ComputeFrictionImpulse(stoppingImpulse, kBrakeFrictionCoefficient,
+		kBrakeFrictionCoefficient, fixedTime)); //kg*m^2 / s
+	if (fabs(appliedImpulse) > kEpsilon)
+	{
+		ApplyUpstreamAngularImpulse(-appliedImpulse);
+	}
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+void Racecar::Wheel::ApplyContactImpulse(const Real& linearImpulse)
+{
+	RotatingBody::OnUpstreamAngularVelocityChange(-linearImpulse * GetRadius() / ComputeContactInertia());
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
 void Racecar::Wheel::OnDownstreamAngularVelocityChange(const Real& changeInAngularVelocity)
 {
 	RotatingBody::OnDownstreamAngularVelocityChange(changeInAngularVelocity);
 
 	if (true == mIsOnGround)
 	{
-		const Real changeInLinearVelocity = changeInAngularVelocity * mRadius;
+		const Real changeInLinearVelocity = changeInAngularVelocity * GetRadius();
 		if (nullptr != mRacecarBody)
 		{
 			mRacecarBody->OnLinearVelocityChange(changeInLinearVelocity);
@@ -134,7 +250,7 @@ void Racecar::Wheel::OnUpstreamAngularVelocityChange(const Real& changeInAngular
 
 	if (true == mIsOnGround)
 	{
-		const Real changeInLinearVelocity = changeInAngularVelocity * mRadius;
+		const Real changeInLinearVelocity = changeInAngularVelocity * GetRadius();
 		if (nullptr != mRacecarBody)
 		{
 			mRacecarBody->OnLinearVelocityChange(changeInLinearVelocity);
@@ -152,10 +268,10 @@ void Racecar::Wheel::ApplyGroundFriction(const Real& fixedTime)
 {
 	if (true == IsOnGround())
 	{
-		const Real expectedAngularVelocity(mLinearVelocity / mRadius); //radians / sec
+		const Real expectedAngularVelocity(GetLinearVelocity() / GetRadius()); //radians / sec
 		const Real difference = GetAngularVelocity() - expectedAngularVelocity; //faster positive, slower negative
 
-		const Real totalMass((nullptr == mRacecarBody) ? GetMass() : mRacecarBody->GetTotalMass());
+		const Real totalMass(GetMass());
 		//TODO: Understand: Calling RotatingBody::Compute to avoid adding the mass/inertia of the car a second time which
 		//may have been inflating the size of the impulse to be applied for 'infinite' friction.
 
@@ -163,33 +279,29 @@ void Racecar::Wheel::ApplyGroundFriction(const Real& fixedTime)
 		//rotational acceleration / torques and then separately the linear, which we use to need to negate.
 		mIsOnGround = false;
 		const Real totalInertia(ComputeUpstreamInertia());
-		const Real velocityDifference(GetAngularVelocity() * mRadius - GetLinearVelocity());
-		const Real impulse = (velocityDifference * totalInertia * totalMass) / (totalInertia + ((mRadius * mRadius) * totalMass));
-
-		const Real frictionImpulse(ComputeFrictionForce(totalMass) * Racecar::Sign(velocityDifference) * fixedTime);
-		const Real appliedImpulse((fabs(impulse) <= fabs(frictionImpulse) || mGroundFrictionCoefficient <= 0.0) ?
-			impulse : frictionImpulse);
+		const Real velocityDifference(GetAngularVelocity() * GetRadius() - GetLinearVelocity());
+		const Real impulse = (velocityDifference * totalInertia * totalMass) / (totalInertia + ((GetRadius() * GetRadius()) * totalMass));
+
+		Real appliedImpulse(impulse);
+		const std::shared_ptr<const TireSpecification>& tire(GetWheelSpecification().mTire);
+		if (nullptr != tire)
+		{	//The tire is integrated semi-implicitly against how quickly the slip responds to an impulse, which is the
+			//  k = r^2 / I + 1 / m   the matching impulse above divides the slip velocity by.
+			const Real inverseEffectiveMass((GetRadius() * GetRadius()) / totalInertia + 1.0 / totalMass);
+			appliedImpulse = tire->ComputeContactImpulse(velocityDifference, GetLinearVelocity(),
+				ComputeTireLoad(Racecar::GetGravityConstant() * totalMass), inverseEffectiveMass, fixedTime);
+		}
+		else
+		{
+			const Real frictionImpulse(ComputeFrictionForce(totalMass) * Racecar::Sign(velocityDifference) * fixedTime);
+			appliedImpulse = (fabs(impulse) <= fabs(frictionImpulse) || mGroundFrictionCoefficient < 0.0) ? impulse : frictionImpulse;
+		}
 		
 		if (fabs(appliedImpulse) > kEpsilon)
 		{	//Ensure there is some amount of frictional impulse, to avoid NaN.
-			ApplyUpstreamAngularImpulse(-appliedImpulse * mRadius);
-
-			//TODO: Understand:
-			//OLD: We use to apply -2.0 * impulse below, and this is the note of why:
-			//The following is for the 'reversal' of the force/torque applied by the impulse. The drive-train currently
-			//may not have positive/negative values correct, or something? So we do 2 times the impulse to first negate
-			//the impulse then make it in the direction expected by the unit tests... Obviously this needs investigating.
-			//
-			//NEW: We now apply -1.0 * impulse below for linear accelerations since they are NOT being applied during the
-			//ApplyUpstreamTorque since we are using the isOnGround = false hack that is documented above!
-			if (nullptr != mRacecarBody)
-			{	//TODO: DriveTrain: Change ApplyForce to ApplyLinearImpulse for consistency reasons.
-				mRacecarBody->ApplyLinearImpulse(appliedImpulse);
-			}
-			else
-			{
-				//mLinearAcceleration += appliedImpulse / fixedTime / totalMass;
-			}
+			//This is only reached without a racecar body, so there is no body for the linear impulse to move and the
+			//  wheel keeps its linear velocity.
+			ApplyUpstreamAngularImpulse(-appliedImpulse * GetRadius());
 		}
 		mIsOnGround = true;
 	}
@@ -207,7 +319,7 @@ void Racecar::Wheel::SetOnGround(bool isOnGround, const Real& frictionCoefficien
 
 Racecar::Real Racecar::Wheel::GetWheelSpeedMPH(void) const
 {
-	const Real speedMetersPerSecond(GetAngularVelocity() * mRadius);
+	const Real speedMetersPerSecond(GetAngularVelocity() * GetRadius());
 	const Real speedFeetPerSecond(speedMetersPerSecond * 3.28084); //3.28084 is feet in a meter.
 	const Real speedMPH(speedFeetPerSecond * 60 * 60 / 5280.0);    //5280.0 is feet per mile,  60*60 is seconds per hour.
 	return fabs(speedMPH);
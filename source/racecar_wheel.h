@@ -10,11 +10,32 @@
 #define _Racecar_Wheel_h_
 
 #include "rotating_body.h"
+#include "racecar_body.h"
+#include "racecar_friction_joint.h"
+#include "racecar_tire_model.h"
+
+#include <memory>
 
 namespace Racecar
 {
 	class RacecarControllerInterface;
-	class RacecarBody;
+
+	///
+	/// @details The mass, size and brakes of a Wheel which do not change while simulating, a single specification
+	///   can be shared by every wheel of the same model.
+	///
+	struct WheelSpecification : public RotatingBodySpecification
+	{
+		///
+		/// @details The moment of inertia of the wheel is mass * radius^2, all the mass at the radius.
+		///
+		explicit WheelSpecification(const Real& massInKilograms, const Real& radiusInMeters);
+
+		Real mMass;                    //kg
+		Real mRadius;                  //meters
+		Real mMaximumBrakingTorque;    //Nm
+		std::shared_ptr<const TireSpecification> mTire; //nullptr for the simple friction of the ground only.
+	};
 
 	class Wheel : public RotatingBody
 	{
@@ -22,8 +43,18 @@ namespace Racecar
 		static const Real kInfiniteFriction;
 
 		explicit Wheel(const Real& massInKilograms, const Real& radiusInMeters); //kg-m^2
+
+		///
+		/// @details Creates a wheel that shares the specification with any other wheels created from it.
+		///
+		explicit Wheel(const std::shared_ptr<const WheelSpecification>& specification);
 		virtual ~Wheel(void);
 
+		inline std::shared_ptr<const WheelSpecification> GetSpecification(void) const
+		{
+			return GetSharedSpecificationAs<WheelSpecification>();
+		}
+
 		///
 		/// @details Computes the speed of the wheel in miles per hour, from the rate at which it is spinning at.
 		///
@@ -35,22 +66,87 @@ namespace Racecar
 		///
 		/// @details Returns the radius of the wheel in meters.
 		///
-		inline Real GetRadius(void) const { return mRadius; }
+		inline Real GetRadius(void) const { return GetWheelSpecification().mRadius; }
 
 		inline bool IsOnGround(void) const { return mIsOnGround; }
 		void SetOnGround(bool isOnGround, const Real& frictionCoefficient);
 
-		inline const Real& GetLinearVelocity(void) const { return mLinearVelocity; }
-		inline void SetLinearVelocity(const Real& linearVelocity) { mLinearVelocity = linearVelocity; }
+		///
+		/// @details Returns the friction coefficient of the ground beneath the wheel, less than 0 for infinite friction.
+		///
+		inline const Real& GetGroundFrictionCoefficient(void) const { return mGroundFrictionCoefficient; }
+
+		///
+		/// @details Returns the speed of the wheel over the ground in meters / second, which is the speed of the racecar
+		///   body when the wheel is attached to one, as the body is the only owner of the linear velocity.
+		///
+		inline const Real& GetLinearVelocity(void) const { return (nullptr == mRacecarBody) ? mLinearVelocity : mRacecarBody->GetLinearVelocity(); }
 
-		const Real& GetMass(void) const { return mMass; }
+		///
+		/// @note When attached to a racecar body this sets the linear velocity of the body, and every wheel on it.
+		///
+		void SetLinearVelocity(const Real& linearVelocity);
+
+		const Real& GetMass(void) const { return GetWheelSpecification().mMass; }
 		void SetRacecarBody(RacecarBody* racecarBody);
 
-		inline void SetMaximumBrakingTorque(const Real& maximumBrakingTorque) { mMaximumBrakingTorque = maximumBrakingTorque; }
+		///
+		/// @note This modifies the specification, so a wheel sharing it will receive a copy of its own first, unless the
+		///   value is unchanged.
+		///
+		void SetMaximumBrakingTorque(const Real& maximumBrakingTorque);
+
+		///
+		/// @details Grips the ground through the slip ratio of the tire, where the friction coefficient of the ground
+		///   scales the grip of the tire, or the tire grips alone if the ground has infinite friction.
+		///
+		/// @note This modifies the specification, so a wheel sharing it will receive a copy of its own first, unless the
+		///   value is unchanged.
+		///
+		void SetTire(const std::shared_ptr<const TireSpecification>& tire);
 
 		virtual Real ComputeDownstreamInertia(void) const;
 		virtual Real ComputeUpstreamInertia(void) const;
 
+		///
+		/// @details A wheel is always a load, from the ground or the brake.
+		///
+		virtual bool HasDownstreamLoad(void) const override;
+
+		///
+		/// @details Returns the inertia of the wheel and everything upstream of it, without the racecar, which is what
+		///   the RacecarBody solves the ground contact of the wheel against.
+		///
+		Real ComputeContactInertia(void) const;
+
+		///
+		/// @details Returns the load in Newtons the tire grips the ground with, the normal load scaled by the friction
+		///   of the surface the wheel is on.
+		///
+		Real ComputeTireLoad(const Real& normalLoad) const;
+
+		///
+		/// @details Returns the most impulse, in Newton-seconds, the ground can apply to the wheel against the slip
+		///   velocity during the step, which is unlimited for infinite friction.
+		///
+		/// @param inverseEffectiveMass The change in slip velocity from each Newton-second, see TireSpecification.
+		///
+		Real ComputeContactImpulseLimit(const Real& slipVelocity, const Real& normalLoad, const Real& inverseEffectiveMass,
+			const Real& fixedTime) const;
+
+		///
+		/// @details Slows the wheel, everything upstream of it and the racecar it rolls on with the brakes. This is
+		///   called by Simulate() for a wheel without a racecar body, otherwise by RacecarBody::Simulate() once the
+		///   slope has pulled on the racecar, so the brakes can hold against it.
+		///
+		void ApplyBrakes(const Real& fixedTime);
+
+		///
+		/// @details Applies the ground contact impulse, in Newton-seconds, to the wheel and everything upstream of it
+		///   without the racecar, as the RacecarBody applies the total of every wheel to itself.
+		///
+		void ApplyContactImpulse(const Real& linearImpulse);
+
 	protected:
 		virtual void OnControllerChange(const RacecarControllerInterface& racecarController) override;
 		virtual void OnSimulate(const Real& fixedTime) override;
@@ -64,12 +160,12 @@ namespace Racecar
 	private:
 		Real ComputeFrictionForce(const Real& totalMass);
 
-		Real mMass;
-		Real mRadius;
-		Real mLinearVelocity;
-		Real mGroundFrictionCoefficient; //If <= 0.0 assume infinite friction!
-		Real mMaximumBrakingTorque;
+		inline const WheelSpecification& GetWheelSpecification(void) const { return GetSpecificationAs<WheelSpecification>(); }
+
+		Real mLinearVelocity;            //Only used while not attached to a racecar body.
+		Real mGroundFrictionCoefficient; //If < 0.0 assume infinite friction!
 		Real mBrakePedalPosition;
+		FrictionJoint mBrakeJoint;
 		RacecarBody* mRacecarBody;
 		bool mIsOnGround;
 	};
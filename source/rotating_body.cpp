@@ -33,12 +33,32 @@ Racecar::Real Racecar::RadiansSecondToRevolutionsMinute(const Real& radiansSecon
 //-------------------------------------------------------------------------------------------------------------------//
 //-------------------------------------------------------------------------------------------------------------------//
 
-Racecar::RotatingBody::RotatingBody(const Real& momentOfInertia) :
+Racecar::RotatingBodySpecification::RotatingBodySpecification(const Real& momentOfInertia) :
+	mMomentOfInertia(momentOfInertia)
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::RotatingBody::RotatingBody(const Real& momentOfInertia, const ControllerChannels controllerChannels) :
+	RotatingBody(std::make_shared<const RotatingBodySpecification>(momentOfInertia), controllerChannels)
+{
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
+Racecar::RotatingBody::RotatingBody(const std::shared_ptr<const RotatingBodySpecification>& specification,
+	const ControllerChannels controllerChannels) :
 	mInputSource(nullptr),
 	mOutputSources(),
-	mInertia(momentOfInertia),
+	mControllerSubscription(controllerChannels),
+	mSpecification(specification),
+	mOwnsSpecification(false),
 	mAngularVelocity(0)
 {
+	error_if(nullptr == mSpecification, "RotatingBody expects a specification.");
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
@@ -139,6 +159,21 @@ Racecar::Real Racecar::RotatingBody::ComputeDownstreamInertia(void) const
 
 //-------------------------------------------------------------------------------------------------------------------//
 
+bool Racecar::RotatingBody::HasDownstreamLoad(void) const
+{
+	for (const RotatingBody* output : mOutputSources)
+	{
+		if (true == output->HasDownstreamLoad())
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//-------------------------------------------------------------------------------------------------------------------//
+
 Racecar::Real Racecar::RotatingBody::ComputeUpstreamInertia(void) const
 {
 	Real upstreamInertia(GetInertia());
@@ -154,7 +189,10 @@ Racecar::Real Racecar::RotatingBody::ComputeUpstreamInertia(void) const
 
 void Racecar::RotatingBody::ControllerChange(const RacecarControllerInterface& racecarController)
 {
-	OnControllerChange(racecarController);
+	if (true == mControllerSubscription.ConsumeChanges(racecarController))
+	{
+		OnControllerChange(racecarController);
+	}
 }
 
 //-------------------------------------------------------------------------------------------------------------------//
@@ -218,13 +256,6 @@ void Racecar::RotatingBody::OnUpstreamAngularVelocityChange(const Real& changeIn
 
 //-------------------------------------------------------------------------------------------------------------------//
 
-void Racecar::RotatingBody::SetInertia(const Real& inertia)
-{
-	mInertia = inertia;
-}
-
-//-------------------------------------------------------------------------------------------------------------------//
-
 void Racecar::RotatingBody::SetAngularVelocity(const Real& angularVelocity)
 {
 	mAngularVelocity = angularVelocity;
@@ -10,7 +10,9 @@
 #define _Racecar_RotatingBody_h_
 
 #include "racecar.h"
+#include "racecar_controller_channels.h"
 
+#include <memory>
 #include <vector>
 
 namespace Racecar
@@ -24,10 +26,32 @@ namespace Racecar
 
 	class RacecarControllerInterface;
 
+	///
+	/// @details The part of a component specification every RotatingBody needs, each component specification derives
+	///   from it so a body can share the specification with every other body built from the same part.
+	///
+	struct RotatingBodySpecification
+	{
+		explicit RotatingBodySpecification(const Real& momentOfInertia);
+
+		Real mMomentOfInertia;      //kg-m^2, of all the parts turning with the body.
+	};
+
 	class RotatingBody
 	{
 	public:
-		RotatingBody(const Real& momentOfInertia);
+		///
+		/// @param controllerChannels The channels of the controller the body reads, OnControllerChange() is only called
+		///   when one of them has changed.
+		///
+		RotatingBody(const Real& momentOfInertia, const ControllerChannels controllerChannels = kAllControllerChannels);
+
+		///
+		/// @param specification The specification of the component, shared with every body built from it, the type
+		///   must match the one the component reads back with GetSpecificationAs().
+		///
+		RotatingBody(const std::shared_ptr<const RotatingBodySpecification>& specification,
+			const ControllerChannels controllerChannels = kAllControllerChannels);
 		virtual ~RotatingBody(void);
 
 		///
@@ -56,10 +80,16 @@ namespace Racecar
 		void AddOutputSource(RotatingBody* outputSource);
 		
 		///
-		/// @details Should be called whenever the racecar controller changes.
+		/// @details Should be called whenever the racecar controller changes, does nothing unless a channel the body
+		///   reads has changed since the last call.
 		///
 		void ControllerChange(const RacecarControllerInterface& racecarController);
 
+		///
+		/// @details The next ControllerChange() reads every channel of the body again, even if none have changed.
+		///
+		inline void ResetControllerChanges(void) { mControllerSubscription.Invalidate(); }
+
 		///
 		///
 		///
@@ -82,7 +112,7 @@ namespace Racecar
 		///
 		void SetAngularVelocity(const Real& angularVelocity);
 
-		inline Real GetInertia(void) const { return mInertia; }
+		inline Real GetInertia(void) const { return mSpecification->mMomentOfInertia; }
 
 		///
 		///
@@ -94,11 +124,50 @@ namespace Racecar
 		///
 		virtual Real ComputeUpstreamInertia(void) const;
 
+		///
+		/// @details Returns true when something downstream can push back against the body, such as a wheel on the
+		///   ground or its brake. Without a load everything downstream turns rigidly with the body.
+		///
+		virtual bool HasDownstreamLoad(void) const;
+
 	protected:
 		///
-		/// @details Set the inertia of the body in kg-m^2.
+		/// @details Returns the specification as the type the component was constructed with.
 		///
-		void SetInertia(const Real& inertia);
+		template<typename Specification> const Specification& GetSpecificationAs(void) const
+		{
+			return static_cast<const Specification&>(*mSpecification);
+		}
+
+		template<typename Specification> std::shared_ptr<const Specification> GetSharedSpecificationAs(void) const
+		{
+			return std::static_pointer_cast<const Specification>(mSpecification);
+		}
+
+		///
+		/// @details Changes a single value of the specification without touching any other body sharing it. Nothing is
+		///   copied when the value does not change, or when the body already holds the only copy it made itself.
+		///
+		/// @note Specification must be the type the component was constructed with, not one of its bases, or the copy
+		///   would lose the rest of the specification.
+		///
+		template<typename Specification, typename Value, typename NewValue>
+		void ModifySpecification(Value Specification::* member, const NewValue& newValue)
+		{
+			if (GetSpecificationAs<Specification>().*member == newValue)
+			{
+				return;
+			}
+
+			if (false == mOwnsSpecification || 1 != mSpecification.use_count())
+			{
+				mSpecification = std::make_shared<Specification>(GetSpecificationAs<Specification>());
+				mOwnsSpecification = true;
+			}
+
+			//Only a copy made above is ever modified, and that was not created const.
+			const_cast<Specification&>(GetSpecificationAs<Specification>()).*member = newValue;
+		}
 
 		virtual void OnControllerChange(const RacecarControllerInterface& racecarController);
 		virtual void OnSimulate(const Real& fixedTime);
@@ -128,8 +197,10 @@ namespace Racecar
 	private:
 		RotatingBody* mInputSource;
 		std::vector<RotatingBody*> mOutputSources;
+		ControllerSubscription mControllerSubscription;
 
-		Real mInertia;             //Rotating inertia of all components in engine include flywheel and pressure plate.
+		std::shared_ptr<const RotatingBodySpecification> mSpecification;
+		bool mOwnsSpecification;   //True once the body has made its own copy of the specification to modify.
 		Real mAngularVelocity;     //Radians / Second
 	};
 };	/* namespace Racecar */
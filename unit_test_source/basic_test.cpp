@@ -15,6 +15,7 @@
 #include "transmission_test.h"
 #include "linear_motion_test.h"
 #include "racecar_test.h"
+#include "drivetrain_test.h"
 
 #include "../source/racecar.h"
 #include "../source/racecar_controller.h"
@@ -49,27 +50,56 @@ bool Racecar::UnitTests::PerformBasicTests(void)
 
 	PerformTest(SpinningWheelsReleasedFromJack, "Spinning Wheels Released From Jack");
 	PerformTest(FlyingCarHitsTrack, "Flying Car Hits Track");
+	PerformTest(FourWheelsHitTrackTogether, "Four Wheels Hit Track Together");
+	PerformTest(RacecarBodyOwnsLinearMotion, "Racecar Body Owns Linear Motion");
+	PerformTest(SuspensionLoadTransferTest, "Suspension Load Transfer Test");
+	PerformTest(PlanarDynamicsTest, "Planar Dynamics Test");
+	PerformTest(TrackProfileTest, "Track Profile Test");
 
 	PerformTest(BasicEngineTest, "Basic Engine Test");
 	PerformTest(EngineTorqueTest, "Engine Torque Test");
+	PerformTest(EngineTorqueCurveLookupTest, "Engine Torque Curve Lookup Test");
+	PerformTest(EngineTorqueMapTest, "Engine Torque Map Test");
+	PerformTest(EngineConstexprTorqueCurveTest, "Engine Constexpr Torque Curve Test");
+	PerformTest(EngineSharedSpecificationTest, "Engine Shared Specification Test");
+	PerformTest(EngineAnalyticIntegrationTest, "Engine Analytic Integration Test");
+	PerformTest(EngineAnalyticNeutralTest, "Engine Analytic Neutral Test");
+	PerformTest(EngineSpeedLimitTest, "Engine Speed Limit Test");
 	PerformTest(WheelBrakingTest, "Wheel Braking Test");
 	PerformTest(WheelNegativeBrakingTest, "Wheel Negative Braking Test");
 	PerformTest(WheelAndAxleBrakingTest, "Wheel And Axle Braking Test");
 	PerformTest(WheelClutchAndEngineBrakingTest, "Wheel Clutch And Engine Braking Test"); //Looking for potential NaN
+	PerformTest(TireModelTest, "Tire Model Test");
+	PerformTest(TireLowSpeedStabilityTest, "Tire Low Speed Stability Test");
+	PerformTest(SurfaceMapTest, "Surface Map Test");
 	PerformTest(EngineClutchWheelThrottleTest, "Engine, Clutch Wheel Throttle Test");     //Checking to ensure the clutch/wheel don't spin faster than engine.
 	PerformTest(EngineClutchWheelBrakingTest, "Engine, Clutch Wheel Braking Test");       //Checking if brakes slow engine with clutch disengaged.
 	PerformTest(EngineClutchWheelMismatchTest, "Engine, Clutch Wheel Mismatch Test");     //Ensures the wheel and clutch remain same speeds while trying to match engine speed.
 	PerformTest(EngineWithConnectionTest, "Engine With Connection Test");
 	PerformTest(ClutchInputTest, "Clutch Input Test");
 	PerformTest(SlippingClutchTest, "Slipping Clutch Test");
+	PerformTest(ClutchJointLockTest, "Clutch Joint Lock Test");
+	PerformTest(FrictionJointTest, "Friction Joint Test");
 	PerformTest(LockedDifferentialTest, "Locked Differential Test");
 //	PerformTest(LockedDifferentialBrakingTest, "Locked Differential Braking Test");
 //	PerformTest(LockedDifferentialUsageTest, "Locked Differential Usage Test");
+	PerformTest(OpenDifferentialTest, "Open Differential Test");
+	PerformTest(LimitedSlipDifferentialTest, "Limited Slip Differential Test");
 	PerformTest(TransmissionNeutralToFirstTest, "Transmission Neutral to First Test");
 	PerformTest(TransmissionBrakeInNeutralTest, "Transmission Brake in Neutral Test");
 	PerformTest(TransmissionBrakeInReverseTest, "Transmission Brake in Reverse Test");
+	PerformTest(TransmissionNumberOfGearsTest, "Transmission Number of Gears Test");
+	PerformTest(ShiftSchedulerTest, "Shift Scheduler Test");
+	PerformTest(ShiftPointTableTest, "Shift Point Table Test");
+	PerformTest(ShiftMapShiftPointsTest, "Shift Map Shift Points Test");
 
 	PerformTest(RacecarReverseTest, "Racecar Reverse Test");
+	PerformTest(ControllerEventQueueTest, "Controller Event Queue Test");
+	PerformTest(ControllerChannelTest, "Controller Channel Test");
+	PerformTest(DrivetrainFidelityTest, "Drivetrain Fidelity Test");
+	PerformTest(DrivetrainFidelitySwitchTest, "Drivetrain Fidelity Switch Test");
+	PerformTest(GearRatioOptimizerTest, "Gear Ratio Optimizer Test");
+	PerformTest(LapSimulatorTest, "Lap Simulator Test");
 	//PerformTest(RacecarAccelerationTest, "Racecar Acceleration Test");
 	//PerformTest(RacecarZeroToSixtyTest, "Racecar Zero To Sixty Test");
 
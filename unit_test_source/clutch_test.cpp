@@ -12,6 +12,7 @@
 #include "../source/racecar.h"
 #include "../source/racecar_controller.h"
 #include "../source/racecar_engine.h"
+#include "../source/racecar_friction_joint.h"
 #include "../source/racecar_clutch.h"
 #include "../source/racecar_wheel.h"
 
@@ -513,3 +514,98 @@ bool Racecar::UnitTests::EngineClutchWheelMismatchTest(void)
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::ClutchJointLockTest(void)
+{
+	Racecar::RotatingBody inputBody(10.0);
+	Racecar::RotatingBody outputBody(10.0);
+	inputBody.SetAngularVelocity(0.0);
+	outputBody.SetAngularVelocity(40.3);
+
+	//Kinetic friction of 400Nm applies 4 per step, matching speeds takes an impulse of 201.5 so the speeds will match
+	//0.00375 seconds into the 51st step.
+	Racecar::ClutchJoint clutchJoint;
+	clutchJoint.SetNormalForce(1000.0);
+	for (int step(0); step < 51; ++step)
+	{
+		ExpectedValue(clutchJoint.IsLocked(), false, "ClutchJoint should be slipping before speeds match.");
+
+		const Real impulse(clutchJoint.ComputeTorqueImpulse(inputBody, outputBody, 0.6, 0.4, kTestFixedTimeStep));
+		inputBody.ApplyDownstreamAngularImpulse(impulse);
+		outputBody.ApplyDownstreamAngularImpulse(-impulse);
+	}
+
+	ExpectedValue(clutchJoint.IsLocked(), true, "ClutchJoint should lock once speeds match.");
+	ExpectedValueWithin(clutchJoint.GetSlipTime(), 0.00375, kTestEpsilon, "ClutchJoint should lock at the exact time.");
+	ExpectedValueWithin(inputBody.GetAngularVelocity(), 20.15, kTestEpsilon, "Input should be at the matched speed.");
+	ExpectedValueWithin(outputBody.GetAngularVelocity(), 20.15, kTestEpsilon, "Output should be at the matched speed.");
+
+	//A load of 300Nm is within the 600Nm static friction can hold, so the joint should not slip or chatter.
+	for (int step(0); step < 100; ++step)
+	{
+		outputBody.ApplyDownstreamAngularImpulse(300.0 * kTestFixedTimeStep);
+
+		const Real impulse(clutchJoint.ComputeTorqueImpulse(inputBody, outputBody, 0.6, 0.4, kTestFixedTimeStep));
+		inputBody.ApplyDownstreamAngularImpulse(impulse);
+		outputBody.ApplyDownstreamAngularImpulse(-impulse);
+
+		if (false == ExpectedValueWithin(inputBody.GetAngularVelocity(), outputBody.GetAngularVelocity(), kTestEpsilon,
+			"ClutchJoint should hold the speeds together while locked."))
+		{
+			return false;
+		}
+	}
+
+	return ExpectedValue(clutchJoint.IsLocked(), true, "ClutchJoint should remain locked.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::FrictionJointTest(void)
+{
+	//Joints that remain slipping, lock partway through a step, hold while locked and break free once locked.
+	const std::array<Real, 4> staticFrictionCoefficients = { 0.6, 0.6, 0.45, 1.0 };
+	const std::array<Real, 4> kineticFrictionCoefficients = { 0.4, 0.4, 0.45, 0.8 };
+	const std::array<Real, 4> normalForces = { 1000.0, 1000.0, 10.0, 0.0 };
+	const std::array<std::array<Real, 4>, 3> matchingImpulses = { {
+		{ 201.5, 2.0, 0.03, 1.0 },
+		{ 3.0, 5.0, -0.05, 0.0 },
+		{ 10.0, 7.0, 0.05, -2.0 },
+	} };
+
+	std::array<Racecar::FrictionJoint, 4> frictionJoints;
+	for (size_t jointIndex(0); jointIndex < normalForces.size(); ++jointIndex)
+	{
+		frictionJoints[jointIndex].SetNormalForce(normalForces[jointIndex]);
+	}
+
+	std::array<std::array<Real, 4>, 3> frictionImpulses;
+	std::array<std::array<Real, 4>, 3> slipTimes;
+	for (size_t stepIndex(0); stepIndex < matchingImpulses.size(); ++stepIndex)
+	{
+		for (size_t jointIndex(0); jointIndex < frictionJoints.size(); ++jointIndex)
+		{
+			frictionImpulses[stepIndex][jointIndex] = frictionJoints[jointIndex].ComputeFrictionImpulse(
+				matchingImpulses[stepIndex][jointIndex], staticFrictionCoefficients[jointIndex],
+				kineticFrictionCoefficients[jointIndex], kTestFixedTimeStep);
+			slipTimes[stepIndex][jointIndex] = frictionJoints[jointIndex].GetSlipTime();
+		}
+	}
+
+	//The first joint slips for the entire first step, locks 0.0075 seconds into the second then breaks free in the third.
+	ExpectedValueWithin(frictionImpulses[0][0], 4.0, kTestEpsilon, "FrictionJoint should slip with kinetic friction.");
+	ExpectedValueWithin(slipTimes[0][0], kTestFixedTimeStep, kTestEpsilon, "FrictionJoint should slip the entire step.");
+	ExpectedValueWithin(frictionImpulses[1][0], 3.0, kTestEpsilon, "FrictionJoint should match the speeds.");
+	ExpectedValueWithin(slipTimes[1][0], 0.0075, kTestEpsilon, "FrictionJoint should lock at the exact time.");
+	ExpectedValue(frictionJoints[0].IsLocked(), false, "FrictionJoint should have broken free.");
+	ExpectedValueWithin(frictionImpulses[2][0], 4.0, kTestEpsilon, "FrictionJoint should be slipping.");
+
+	//The second joint holds on static friction from the first step until the third step overcomes it.
+	ExpectedValueWithin(slipTimes[1][1], 0.0, kTestEpsilon, "FrictionJoint should remain locked.");
+	ExpectedValueWithin(frictionImpulses[1][1], 5.0, kTestEpsilon, "FrictionJoint should hold within static friction.");
+	ExpectedValue(frictionJoints[1].IsLocked(), false, "FrictionJoint should have broken free.");
+	ExpectedValue(frictionJoints[2].IsLocked(), false, "FrictionJoint should be slipping.");
+	return ExpectedValueWithin(frictionImpulses[2][3], 0.0, kTestEpsilon, "FrictionJoint without force should do nothing.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
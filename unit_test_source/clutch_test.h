@@ -36,6 +36,18 @@ namespace Racecar
 		///
 		bool EngineClutchWheelMismatchTest(void);
 
+		///
+		/// @details Checks the ClutchJoint locks at the exact time within a step that the speeds match, then remains
+		///   locked while the load is within what static friction can hold.
+		///
+		bool ClutchJointLockTest(void);
+
+		///
+		/// @details Checks FrictionJoints slip, lock partway through a step, hold while locked and break free again,
+		///   carrying the lock state from one step to the next.
+		///
+		bool FrictionJointTest(void);
+
 	};
 };
 
@@ -13,6 +13,8 @@
 #include "../source/racecar_controller.h"
 #include "../source/racecar_engine.h"
 #include "../source/racecar_locked_differential.h"
+#include "../source/racecar_open_differential.h"
+#include "../source/racecar_limited_slip_differential.h"
 #include "../source/racecar_wheel.h"
 
 #include <array>
@@ -280,6 +282,145 @@ bool Racecar::UnitTests::LockedDifferentialBrakingTest(void)
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+bool Racecar::UnitTests::OpenDifferentialTest(void)
+{
+	Racecar::ProgrammaticController racecarController;
+	Racecar::ConstantEngine engine(10.0, 200.0, 0.0);
+	Racecar::OpenDifferential openDifferential(10.0, 1.0);
+	Racecar::RotatingBody leftOutput(10.0);
+	Racecar::RotatingBody rightOutput(30.0);
+
+	engine.AddOutputSource(&openDifferential);
+	openDifferential.SetInputSource(&engine);
+	openDifferential.AddOutputSource(&leftOutput);
+	leftOutput.SetInputSource(&openDifferential);
+	openDifferential.AddOutputSource(&rightOutput);
+	rightOutput.SetInputSource(&openDifferential);
+
+	//The engine sees 10 + (10 + 4 * 10 * 30 / 40) = 50 kg-m^2, so 2 kg-m^2/s speeds the carrier by 0.04 and the 0.6
+	//kg-m^2/s given to each output turns the light output three times faster than the heavy one.
+	ExpectedValueWithin(engine.ComputeDownstreamInertia(), 50.0, kTestEpsilon, "Wrong inertia through the open differential.");
+
+	racecarController.SetThrottlePosition(1.0f);
+	engine.ControllerChange(racecarController);
+	openDifferential.ControllerChange(racecarController);
+	engine.Simulate(kTestFixedTimeStep);
+	openDifferential.Simulate(kTestFixedTimeStep);
+
+	ExpectedValueWithin(engine.GetAngularVelocity(), 0.04, kTestEpsilon, "Engine did not accelerate as expected.");
+	ExpectedValueWithin(openDifferential.GetAngularVelocity(), 0.04, kTestEpsilon, "Carrier did not accelerate as expected.");
+	ExpectedValueWithin(leftOutput.GetAngularVelocity(), 0.06, kTestEpsilon, "Light output did not accelerate as expected.");
+	ExpectedValueWithin(rightOutput.GetAngularVelocity(), 0.02, kTestEpsilon, "Heavy output did not accelerate as expected.");
+	ExpectedValueWithin(openDifferential.GetInputTorque(), 160.0, kTestEpsilon, "Wrong torque delivered to the differential.");
+
+	for (int timer(10); timer < 1000; timer += 10)
+	{
+		engine.ControllerChange(racecarController);
+		openDifferential.ControllerChange(racecarController);
+		engine.Simulate(kTestFixedTimeStep);
+		openDifferential.Simulate(kTestFixedTimeStep);
+	}
+
+	ExpectedValueWithin(leftOutput.GetAngularVelocity(), 6.0, kTestEpsilon, "Light output did not accelerate as expected.");
+	ExpectedValueWithin(rightOutput.GetAngularVelocity(), 2.0, kTestEpsilon, "Heavy output did not accelerate as expected.");
+	ExpectedValueWithin(engine.GetAngularVelocity(), 4.0, kTestEpsilon, "Engine should follow the average of the outputs.");
+
+	//Braking the light output by 1 kg-m^2/s, with the carrier and engine making up 20 kg-m^2, solves the mass matrix
+	//  | 15  5 |
+	//  |  5 35 |   for changes of -0.07 on the braked output and +0.01 on the other.
+	leftOutput.ApplyUpstreamAngularImpulse(-1.0);
+	ExpectedValueWithin(leftOutput.GetAngularVelocity(), 6.0 - 0.07, kTestEpsilon, "Braked output did not slow as expected.");
+	ExpectedValueWithin(rightOutput.GetAngularVelocity(), 2.0 + 0.01, kTestEpsilon, "Other output should speed up when braking one.");
+	ExpectedValueWithin(openDifferential.GetAngularVelocity(), 4.0 - 0.03, kTestEpsilon, "Carrier should stay at the average of the outputs.");
+	return ExpectedValueWithin(engine.GetAngularVelocity(), 4.0 - 0.03, kTestEpsilon, "Engine should stay with the carrier.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::LimitedSlipDifferentialTest(void)
+{
+	struct LimitedSlipTestBlob
+	{
+		Real preloadTorque;
+		Real rampCoefficient;
+		Real mExpectedLeftAngularVelocity;
+		Real mExpectedRightAngularVelocity;
+		Real mExpectedEngineAngularVelocity;
+	};
+
+	//With no locking torque it is an open differential, and a preload more than the torque split can hold locks the
+	//outputs together so the engine turns all 60 kg-m^2 at 200 / 60 rad/s after a second.
+	const std::array<LimitedSlipTestBlob, 2> tests{
+		LimitedSlipTestBlob{ 0.0,    0.0, 6.0, 2.0, 4.0 },
+		LimitedSlipTestBlob{ 1000.0, 0.0, 3.33333333, 3.33333333, 3.33333333 },
+	};
+
+	for (const LimitedSlipTestBlob& test : tests)
+	{
+		Racecar::ProgrammaticController racecarController;
+		Racecar::ConstantEngine engine(10.0, 200.0, 0.0);
+		Racecar::LimitedSlipDifferential limitedSlipDifferential(std::make_shared<const LimitedSlipDifferentialSpecification>(
+			10.0, 1.0, test.preloadTorque, test.rampCoefficient, test.rampCoefficient));
+		Racecar::RotatingBody leftOutput(10.0);
+		Racecar::RotatingBody rightOutput(30.0);
+
+		engine.AddOutputSource(&limitedSlipDifferential);
+		limitedSlipDifferential.SetInputSource(&engine);
+		limitedSlipDifferential.AddOutputSource(&leftOutput);
+		leftOutput.SetInputSource(&limitedSlipDifferential);
+		limitedSlipDifferential.AddOutputSource(&rightOutput);
+		rightOutput.SetInputSource(&limitedSlipDifferential);
+
+		racecarController.SetThrottlePosition(1.0f);
+		for (int timer(0); timer < 1000; timer += 10)
+		{
+			engine.ControllerChange(racecarController);
+			limitedSlipDifferential.ControllerChange(racecarController);
+			engine.Simulate(kTestFixedTimeStep);
+			limitedSlipDifferential.Simulate(kTestFixedTimeStep);
+		}
+
+		ExpectedValueWithin(leftOutput.GetAngularVelocity(), test.mExpectedLeftAngularVelocity, kTestEpsilon, "Wrong speed of the light output.");
+		ExpectedValueWithin(rightOutput.GetAngularVelocity(), test.mExpectedRightAngularVelocity, kTestEpsilon, "Wrong speed of the heavy output.");
+		ExpectedValueWithin(engine.GetAngularVelocity(), test.mExpectedEngineAngularVelocity, kTestEpsilon, "Engine should follow the average of the outputs.");
+		ExpectedValue(limitedSlipDifferential.IsLocked(), test.preloadTorque > 0.0, "Only the preloaded differential should lock.");
+	}
+
+	{	//The ramp alone locks with an eighth of the 160 Nm at the carrier, which is not enough to hold outputs that need
+		//  (30 - 10) / (10 + 30) * 160 / 2 = 40 Nm   so they separate, but more slowly than the open differential.
+		Racecar::ProgrammaticController racecarController;
+		Racecar::ConstantEngine engine(10.0, 200.0, 0.0);
+		Racecar::LimitedSlipDifferential limitedSlipDifferential(std::make_shared<const LimitedSlipDifferentialSpecification>(10.0, 1.0, 0.0, 0.125, 0.0));
+		Racecar::RotatingBody leftOutput(10.0);
+		Racecar::RotatingBody rightOutput(30.0);
+
+		engine.AddOutputSource(&limitedSlipDifferential);
+		limitedSlipDifferential.SetInputSource(&engine);
+		limitedSlipDifferential.AddOutputSource(&leftOutput);
+		leftOutput.SetInputSource(&limitedSlipDifferential);
+		limitedSlipDifferential.AddOutputSource(&rightOutput);
+		rightOutput.SetInputSource(&limitedSlipDifferential);
+
+		racecarController.SetThrottlePosition(1.0f);
+		engine.ControllerChange(racecarController);
+		limitedSlipDifferential.ControllerChange(racecarController);
+		engine.Simulate(kTestFixedTimeStep);
+		limitedSlipDifferential.Simulate(kTestFixedTimeStep);
+
+		ExpectedValueWithin(limitedSlipDifferential.GetLockingTorque(), 20.0, kTestEpsilon, "Ramp should lock with an eighth of the carrier torque.");
+		ExpectedValue(limitedSlipDifferential.IsLocked(), false, "Ramp should not hold the outputs together.");
+
+		const Real speedDifference(leftOutput.GetAngularVelocity() - rightOutput.GetAngularVelocity());
+		ExpectedValue(speedDifference > 0.0 && speedDifference < 0.04, true, "The ramp should slow, but not stop, the outputs separating.");
+		ExpectedValueWithin((leftOutput.GetAngularVelocity() + rightOutput.GetAngularVelocity()) * 0.5,
+			limitedSlipDifferential.GetAngularVelocity(), kTestEpsilon, "Carrier should stay at the average of the outputs.");
+	}
+
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 bool Racecar::UnitTests::LockedDifferentialUsageTest(void)
 {
 	//These tests not completely written, so the test themselves may be skewed/wrong.
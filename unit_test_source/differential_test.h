@@ -16,6 +16,18 @@ namespace Racecar
 		bool LockedDifferentialTest(void);
 		bool LockedDifferentialBrakingTest(void);
 		bool LockedDifferentialUsageTest(void);
+
+		///
+		/// @details Drives unequal outputs through an open differential, checking the torque is split evenly and the
+		///   carrier stays at the average speed, then brakes one output which speeds up the other.
+		///
+		bool OpenDifferentialTest(void);
+
+		///
+		/// @details Checks a limited-slip differential with no locking torque behaves as an open differential, a large
+		///   preload holds unequal outputs at the same speed, and the ramp locks in proportion to the input torque.
+		///
+		bool LimitedSlipDifferentialTest(void);
 	};
 };
 
@@ -0,0 +1,235 @@
+///
+/// @file
+/// @details A handful of test functions for testing the drive-train at each fidelity level.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#include "drivetrain_test.h"
+#include "test_kit.h"
+
+#include "../source/racecar.h"
+#include "../source/racecar_controller.h"
+#include "../source/racecar_drivetrain.h"
+#include "../source/racecar_gear_optimizer.h"
+#include "../source/racecar_lap_simulator.h"
+#include "../source/racecar_track_profile.h"
+
+#include <array>
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace
+{
+	std::shared_ptr<const Racecar::DrivetrainSpecification> MiataDrivetrainSpecification(void)
+	{
+		const std::array<Racecar::Real, 6> forwardGearRatios{ 3.136, 1.888, 1.330, 1.000, 0.814, 0.0 };
+		return std::make_shared<const Racecar::DrivetrainSpecification>(
+			std::make_shared<const Racecar::EngineSpecification>(0.053772533834764477, Racecar::TorqueMap::FromTorqueCurve(Racecar::TorqueCurve::MiataTorqueCurve())),
+			std::make_shared<const Racecar::ClutchSpecification>(0.036579954989635705, 10000.0),
+			std::make_shared<const Racecar::TransmissionSpecification>(0.0044810444862303728, forwardGearRatios, -3.758),
+			std::make_shared<const Racecar::DifferentialSpecification>(0.0044810444862303728, 4.3),
+			std::make_shared<const Racecar::WheelSpecification>(18.144, 0.2794),
+			1042.0);
+	}
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::DrivetrainFidelityTest(void)
+{
+	const std::shared_ptr<const DrivetrainSpecification> specification(MiataDrivetrainSpecification());
+	Racecar::ProgrammaticController racecarController;
+	racecarController.SetShifterPosition(Gear::Second);
+	racecarController.SetThrottlePosition(1.0f);
+
+	std::array<Real, 3> finalLinearVelocity;
+	const std::array<DrivetrainFidelity, 3> fidelities{ DrivetrainFidelity::Full, DrivetrainFidelity::Reduced, DrivetrainFidelity::Kinematic };
+	for (size_t index(0); index < fidelities.size(); ++index)
+	{
+		Drivetrain drivetrain(specification, fidelities[index]);
+		drivetrain.ControllerChange(racecarController);
+		drivetrain.SetLinearVelocity(5.0);
+
+		for (int timer(0); timer < 2000; timer += 10)
+		{
+			drivetrain.ControllerChange(racecarController);
+			drivetrain.Simulate(kTestFixedTimeStep);
+		}
+
+		finalLinearVelocity[index] = drivetrain.GetLinearVelocity();
+	}
+
+	ExpectedValueWithin(finalLinearVelocity[1], finalLinearVelocity[0], 0.01, "Reduced fidelity should be close to full fidelity.");
+	return ExpectedValueWithin(finalLinearVelocity[2], finalLinearVelocity[0], 0.05, "Kinematic fidelity should be close to full fidelity.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::DrivetrainFidelitySwitchTest(void)
+{
+	const std::shared_ptr<const DrivetrainSpecification> specification(MiataDrivetrainSpecification());
+	Racecar::ProgrammaticController racecarController;
+	racecarController.SetShifterPosition(Gear::Second);
+	racecarController.SetThrottlePosition(1.0f);
+
+	Drivetrain fullDrivetrain(specification, DrivetrainFidelity::Full);
+	Drivetrain drivetrain(specification, DrivetrainFidelity::Full);
+	fullDrivetrain.ControllerChange(racecarController);
+	fullDrivetrain.SetLinearVelocity(5.0);
+	drivetrain.ControllerChange(racecarController);
+	drivetrain.SetLinearVelocity(5.0);
+
+	const std::array<DrivetrainFidelity, 4> fidelities{ DrivetrainFidelity::Reduced, DrivetrainFidelity::Kinematic,
+		DrivetrainFidelity::Full, DrivetrainFidelity::Kinematic };
+	for (const DrivetrainFidelity& fidelity : fidelities)
+	{
+		for (int timer(0); timer < 500; timer += 10)
+		{
+			fullDrivetrain.ControllerChange(racecarController);
+			fullDrivetrain.Simulate(kTestFixedTimeStep);
+			drivetrain.ControllerChange(racecarController);
+			drivetrain.Simulate(kTestFixedTimeStep);
+		}
+
+		const Real linearVelocity(drivetrain.GetLinearVelocity());
+		drivetrain.SetFidelity(fidelity);
+		ExpectedValue(drivetrain.GetLinearVelocity(), linearVelocity, "Changing fidelity should not change the speed.");
+		ExpectedValueWithin(drivetrain.GetEngine().GetAngularVelocity(), drivetrain.GetWheel().GetAngularVelocity() *
+			specification->GetOverallRatio(Gear::Second), kTestEpsilon, "Engine speed should match the wheel through the gears.");
+	}
+
+	for (int timer(0); timer < 500; timer += 10)
+	{
+		fullDrivetrain.ControllerChange(racecarController);
+		fullDrivetrain.Simulate(kTestFixedTimeStep);
+		drivetrain.ControllerChange(racecarController);
+		drivetrain.Simulate(kTestFixedTimeStep);
+	}
+
+	return ExpectedValueWithin(drivetrain.GetLinearVelocity(), fullDrivetrain.GetLinearVelocity(), 0.05,
+		"Changing fidelity while driving should remain close to full fidelity.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::GearRatioOptimizerTest(void)
+{
+	const std::shared_ptr<const DrivetrainSpecification> specification(MiataDrivetrainSpecification());
+	const std::vector<GearRatioBounds> gearRatioBounds{ GearRatioBounds(2.5, 3.5), GearRatioBounds(1.5, 2.2),
+		GearRatioBounds(1.1, 1.6), GearRatioBounds(0.9, 1.2), GearRatioBounds(0.7, 1.0) };
+
+	GearOptimizerSettings settings(GearOptimizerTarget::ZeroToHundred, gearRatioBounds, GearRatioBounds(3.5, 4.8));
+	settings.mNumberOfCandidates = 48;
+	settings.mNumberOfThreads = 4;
+	settings.mMaximumTime = 40.0;
+	settings.mSeed = 37;
+
+	//Overlapping bounds, where a high draw for one gear leaves only part of the range of the next.
+	const std::vector<GearRatioBounds> overlappingBounds{ GearRatioBounds(2.0, 4.0), GearRatioBounds(2.0, 3.5),
+		GearRatioBounds(1.0, 3.0) };
+	ExpectedValue(HasDescendingMinimumRatios(overlappingBounds), true, "Overlapping bounds should have descending minimums.");
+	ExpectedValue(HasDescendingMinimumRatios({ GearRatioBounds(2.0, 4.0), GearRatioBounds(2.5, 3.0) }), false,
+		"A gear with a higher minimum than the gear below should be rejected.");
+
+	std::vector<Real> drawnRatios(overlappingBounds.size());
+	for (uint64_t drawIndex(0); drawIndex < 200; ++drawIndex)
+	{
+		DrawGearRatios(overlappingBounds, 11, drawIndex * overlappingBounds.size(), drawnRatios);
+		ExpectedValue(drawnRatios[0] >= drawnRatios[1] && drawnRatios[1] >= drawnRatios[2] && drawnRatios[1] >= 2.0 &&
+			drawnRatios[2] >= 1.0, true, "Drawn gear ratios should descend within the bounds.");
+	}
+
+	const GearOptimizerResult result(GearRatioOptimizer(specification, settings).Optimize());
+	const GearRatioCandidate& best(result.mBest);
+
+	ExpectedValue(best.mGearRatios.size(), gearRatioBounds.size(), "Best candidate has the wrong number of gears.");
+	for (size_t gearIndex(0); gearIndex < best.mGearRatios.size(); ++gearIndex)
+	{
+		ExpectedValue(best.mGearRatios[gearIndex] >= gearRatioBounds[gearIndex].mMinimumRatio &&
+			best.mGearRatios[gearIndex] <= gearRatioBounds[gearIndex].mMaximumRatio, true, "Gear ratio is outside of the bounds.");
+		ExpectedValue(0 == gearIndex || best.mGearRatios[gearIndex] <= best.mGearRatios[gearIndex - 1], true, "Gear ratios should descend.");
+	}
+
+	ExpectedValue(best.mZeroToHundredTime < settings.mMaximumTime, true, "Best candidate should reach 100 km/h.");
+	ExpectedValueWithin(best.mScore, best.mZeroToHundredTime, kTestEpsilon, "Score should be the time to 100 km/h.");
+
+	ExpectedValue(result.mParetoFront.empty(), false, "Expected a Pareto front.");
+	ExpectedValueWithin(result.mParetoFront.front().mZeroToHundredTime, best.mZeroToHundredTime, kTestEpsilon,
+		"The quickest launch should start the Pareto front.");
+	for (size_t frontIndex(1); frontIndex < result.mParetoFront.size(); ++frontIndex)
+	{
+		const GearRatioCandidate& previous(result.mParetoFront[frontIndex - 1]);
+		const GearRatioCandidate& current(result.mParetoFront[frontIndex]);
+		ExpectedValue(current.mZeroToHundredTime >= previous.mZeroToHundredTime && current.mTopSpeed > previous.mTopSpeed, true,
+			"Each step along the Pareto front should trade launch time for top speed.");
+	}
+
+	settings.mNumberOfThreads = 1;
+	const GearOptimizerResult singleThreadResult(GearRatioOptimizer(specification, settings).Optimize());
+	ExpectedValue(singleThreadResult.mBest.mGearRatios, best.mGearRatios, "Result should not depend on the number of threads.");
+	return ExpectedValue(singleThreadResult.mParetoFront.size(), result.mParetoFront.size(), "Pareto front should not depend on the number of threads.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::LapSimulatorTest(void)
+{
+	//A 200m straight into a 40m radius corner, then a 200m straight to the line.
+	std::vector<TrackSample> samples(601, TrackSample{ 0.0f, 0.0f });
+	for (size_t sampleIndex(200); sampleIndex < 400; ++sampleIndex)
+	{
+		samples[sampleIndex].mCurvature = 1.0f / 40.0f;
+	}
+
+	TrackProfile lap(samples, 1.0);
+	const std::shared_ptr<const DrivetrainSpecification> specification(MiataDrivetrainSpecification());
+	const std::vector<GearRatioBounds> gearRatioBounds{ GearRatioBounds(2.8, 3.3), GearRatioBounds(1.8, 2.1),
+		GearRatioBounds(1.2, 1.5), GearRatioBounds(0.95, 1.1), GearRatioBounds(0.75, 0.9) };
+
+	LapSimulatorSettings settings(gearRatioBounds, GearRatioBounds(3.9, 4.4), ParameterRange(6000.0, 8000.0), ParameterRange(1500.0, 2500.0));
+	settings.mNumberOfLaps = 32;
+	settings.mNumberOfThreads = 4;
+	settings.mMaximumLapTime = 120.0;
+	settings.mSeed = 41;
+
+	const LapSimulationResult result(LapSimulator(specification, lap, settings).Simulate());
+	const LapTimeDistribution& distribution(result.mDistribution);
+
+	ExpectedValue(result.mLaps.size(), settings.mNumberOfLaps, "Expected a record of every lap.");
+	ExpectedValue(distribution.mNumberOfLaps, settings.mNumberOfLaps, "Every lap should have finished.");
+	ExpectedValue(distribution.mNumberOfUnfinished, size_t(0), "Every lap should have finished.");
+	ExpectedValue(distribution.mFastestLapTime <= distribution.mTenthPercentile && distribution.mTenthPercentile <= distribution.mMedianLapTime &&
+		distribution.mMedianLapTime <= distribution.mNinetiethPercentile && distribution.mNinetiethPercentile <= distribution.mSlowestLapTime,
+		true, "Lap time distribution should be ordered.");
+	ExpectedValueWithin(distribution.mFastestLapTime, result.mFastest.mLapTime, 1.0e-6, "Fastest lap should match the distribution.");
+
+	//Taking the 40m corner at the grip limit is about 20 m/s, so the lap can not be quicker than flat out at the
+	//  start speed through the corner, nor slower than that speed all the way around.
+	ExpectedValue(distribution.mFastestLapTime > 200.0 / 20.0 && distribution.mSlowestLapTime < 600.0 / 15.0, true, "Lap time is unreasonable.");
+
+	settings.mNumberOfThreads = 1;
+	const LapSimulationResult singleThreadResult(LapSimulator(specification, lap, settings).Simulate());
+	for (size_t lapIndex(0); lapIndex < result.mLaps.size(); ++lapIndex)
+	{
+		ExpectedValue(singleThreadResult.mLaps[lapIndex].mLapTime, result.mLaps[lapIndex].mLapTime, "Result should not depend on the number of threads.");
+	}
+
+	//Without a range or noise every lap drives the same.
+	LapSimulatorSettings fixedSettings(std::vector<GearRatioBounds>{ GearRatioBounds(3.1, 3.1), GearRatioBounds(1.9, 1.9),
+		GearRatioBounds(1.3, 1.3), GearRatioBounds(1.0, 1.0), GearRatioBounds(0.8, 0.8) }, GearRatioBounds(4.1, 4.1),
+		ParameterRange(7000.0, 7000.0), ParameterRange(2000.0, 2000.0));
+	fixedSettings.mThrottleNoise = 0.0;
+	fixedSettings.mBrakeNoise = 0.0;
+	fixedSettings.mBrakePointNoise = 0.0;
+	fixedSettings.mNumberOfLaps = 4;
+	fixedSettings.mNumberOfThreads = 2;
+	fixedSettings.mMaximumLapTime = 120.0;
+
+	const LapSimulationResult fixedResult(LapSimulator(specification, lap, fixedSettings).Simulate());
+	return ExpectedValueWithin(fixedResult.mDistribution.mSlowestLapTime, fixedResult.mDistribution.mFastestLapTime, 1.0e-6,
+		"Laps without noise should match.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,41 @@
+///
+/// @file
+/// @details A handful of test functions for testing the drive-train at each fidelity level.
+///
+/// <!-- This file is made available under the terms of the MIT license(see LICENSE.md) -->
+/// <!-- Copyright (c) 2017 Contributers: Tim Beaudet, -->
+///-----------------------------------------------------------------------------------------------------------------///
+
+#ifndef _Racecar_DrivetrainTest_h_
+#define _Racecar_DrivetrainTest_h_
+
+namespace Racecar
+{
+	namespace UnitTests
+	{
+		///
+		/// @details Checks the Reduced and Kinematic fidelity accelerate the racecar close to the Full fidelity.
+		///
+		bool DrivetrainFidelityTest(void);
+
+		///
+		/// @details Checks the racecar keeps its speed when the fidelity is changed while driving.
+		///
+		bool DrivetrainFidelitySwitchTest(void);
+
+		///
+		/// @details Checks gear ratios drawn from overlapping bounds descend, then runs the GearRatioOptimizer on the miata
+		///   drive-train, checking the candidates stay within the bounds, the Pareto front trades launch time for top
+		///   speed and the result does not depend on the number of threads.
+		///
+		bool GearRatioOptimizerTest(void);
+
+		///
+		/// @details Runs the LapSimulator around a short lap with a single corner, checking every lap finishes, the
+		///   distribution is ordered, laps without noise match and the result does not depend on the number of threads.
+		///
+		bool LapSimulatorTest(void);
+	};
+};
+
+#endif /* _Racecar_DrivetrainTest_h_ */
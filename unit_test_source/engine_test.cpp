@@ -12,6 +12,8 @@
 #include "../source/racecar.h"
 #include "../source/racecar_controller.h"
 #include "../source/racecar_engine.h"
+#include "../source/racecar_clutch.h"
+#include "../source/racecar_transmission.h"
 #include "../source/racecar_wheel.h"
 
 #include <array>
@@ -245,6 +247,271 @@ bool Racecar::UnitTests::EngineTorqueTest(void)
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+bool Racecar::UnitTests::EngineTorqueCurveLookupTest(void)
+{
+	Racecar::TorqueCurve torqueCurve;
+	torqueCurve.AddPlotPoint(3000.0, 150.0);
+	torqueCurve.AddPlotPoint(1000.0, 50.0);
+	torqueCurve.AddPlotPoint(2000.0, 200.0);
+	torqueCurve.NormalizeTorqueCurve(201); //Samples every 10rpm, landing exactly on each of the plotted points.
+
+	ExpectedValue(torqueCurve.GetTableResolution(), size_t(201), "Lookup table should have the requested resolution.");
+	ExpectedValue(torqueCurve.GetMaximumRPM(), 3000.0, "Maximum RPM should be the last plotted point.");
+	ExpectedValue(torqueCurve.GetOutputTorque(0.0), 50.0, "Below the plotted range should clamp to the first point.");
+	ExpectedValue(torqueCurve.GetOutputTorque(1000.0), 50.0, "Output torque at first plotted point.");
+	ExpectedValue(torqueCurve.GetOutputTorque(1500.0), 125.0, "Output torque between the first and second points.");
+	ExpectedValue(torqueCurve.GetOutputTorque(2000.0), 200.0, "Output torque at second plotted point.");
+	ExpectedValue(torqueCurve.GetOutputTorque(2755.0), 162.25, "Output torque between the second and third points.");
+	ExpectedValue(torqueCurve.GetOutputTorque(3000.0), 150.0, "Output torque at last plotted point.");
+	ExpectedValue(torqueCurve.GetOutputTorque(9000.0), 150.0, "Above the plotted range should clamp to the last point.");
+
+	const Racecar::TorqueCurve miataCurve(Racecar::TorqueCurve::MiataTorqueCurve());
+	std::array<Real, 100> engineSpeeds;
+	std::array<Real, 100> outputTorques;
+	for (size_t index(0); index < engineSpeeds.size(); ++index)
+	{
+		engineSpeeds[index] = static_cast<Real>(index) * 90.0;
+	}
+
+	miataCurve.GetOutputTorques(engineSpeeds.data(), outputTorques.data(), engineSpeeds.size());
+	for (size_t index(0); index < engineSpeeds.size(); ++index)
+	{
+		if (false == ExpectedValue(outputTorques[index], miataCurve.GetOutputTorque(engineSpeeds[index]), "Batched lookup does not match single lookup."))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::EngineTorqueMapTest(void)
+{
+	Racecar::TorqueCurve fullThrottleCurve;
+	fullThrottleCurve.AddPlotPoint(1000.0, 100.0);
+	fullThrottleCurve.AddPlotPoint(5000.0, 200.0);
+	fullThrottleCurve.NormalizeTorqueCurve(5);
+
+	Racecar::TorqueCurve halfThrottleCurve;
+	halfThrottleCurve.AddPlotPoint(1000.0, 80.0);
+	halfThrottleCurve.AddPlotPoint(5000.0, 40.0);
+	halfThrottleCurve.NormalizeTorqueCurve(5);
+
+	Racecar::TorqueMap torqueMap;
+	torqueMap.AddThrottleCurve(1.0, fullThrottleCurve);
+	torqueMap.AddThrottleCurve(0.5, halfThrottleCurve);
+	torqueMap.NormalizeTorqueMap(5, 5);
+
+	ExpectedValue(torqueMap.GetOutputTorque(1000.0, 0.0), 0.0, "Closed throttle should produce no torque.");
+	ExpectedValue(torqueMap.GetOutputTorque(3000.0, 1.0), 150.0, "Full throttle should follow the full throttle curve.");
+	ExpectedValue(torqueMap.GetOutputTorque(3000.0, 0.5), 60.0, "Half throttle should follow the half throttle curve.");
+	ExpectedValue(torqueMap.GetOutputTorque(3000.0, 0.25), 30.0, "Quarter throttle should be between closed and half throttle.");
+	ExpectedValue(torqueMap.GetOutputTorque(2000.0, 0.75), 97.5, "Between samples on both axes should be bilinear.");
+	ExpectedValue(torqueMap.GetOutputTorque(9000.0, 2.0), 200.0, "Outside of the map should clamp to the edges.");
+
+	const Racecar::TorqueMap linearMap(Racecar::TorqueMap::FromTorqueCurve(fullThrottleCurve));
+	ExpectedValue(linearMap.GetOutputTorque(2000.0, 0.3), fullThrottleCurve.GetOutputTorque(2000.0) * 0.3, "Map from curve should scale linearly.");
+
+	Racecar::ProgrammaticController racecarController;
+	Racecar::Engine engine(10.0, torqueMap);
+	engine.SetAngularVelocity(Racecar::RevolutionsMinuteToRadiansSecond(3000.0));
+
+	racecarController.SetThrottlePosition(0.5f);
+	engine.ControllerChange(racecarController);
+	engine.Simulate(kTestFixedTimeStep);
+
+	const Real expectedAngularVelocity(Racecar::RevolutionsMinuteToRadiansSecond(3000.0) + 60.0 * kTestFixedTimeStep / 10.0);
+	return ExpectedValue(engine.GetAngularVelocity(), expectedAngularVelocity, "Engine should use the half throttle torque.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::EngineConstexprTorqueCurveTest(void)
+{
+	constexpr Racecar::TorqueCurve compiledCurve({ { 4000.0, 180.0 }, { 1000.0, 90.0 }, { 6500.0, 120.0 } }, 64);
+	static_assert(true == compiledCurve.IsNormalized(), "A constexpr TorqueCurve should be normalized at compile time.");
+	static_assert(64 == compiledCurve.GetTableResolution(), "A constexpr TorqueCurve should have the requested resolution.");
+
+	Racecar::TorqueCurve runtimeCurve;
+	runtimeCurve.AddPlotPoint(1000.0, 90.0);
+	runtimeCurve.AddPlotPoint(4000.0, 180.0);
+	runtimeCurve.AddPlotPoint(6500.0, 120.0);
+	runtimeCurve.NormalizeTorqueCurve(64);
+
+	ExpectedValue(compiledCurve.GetMaximumTorque(), 180.0, "Compiled curve has unexpected maximum torque.");
+	ExpectedValue(compiledCurve.GetMaximumRPM(), 6500.0, "Compiled curve has unexpected maximum RPM.");
+	for (int rpm = 0; rpm < 8000; rpm += 10)
+	{
+		if (false == ExpectedValue(compiledCurve.GetOutputTorque(rpm), runtimeCurve.GetOutputTorque(rpm), "Compiled curve does not match runtime curve."))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::EngineSharedSpecificationTest(void)
+{
+	const std::shared_ptr<const Racecar::EngineSpecification> specification(std::make_shared<const Racecar::EngineSpecification>(
+		10.0, Racecar::TorqueMap::FromTorqueCurve(Racecar::TorqueCurve::MiataTorqueCurve())));
+
+	Racecar::Engine firstEngine(specification);
+	Racecar::Engine secondEngine(specification);
+	ExpectedValue(firstEngine.GetSpecification().get(), specification.get(), "Engine should share the specification.");
+	ExpectedValue(secondEngine.GetSpecification().get(), specification.get(), "Engine should share the specification.");
+	ExpectedValue(secondEngine.GetInertia(), 10.0, "Engine should take its inertia from the specification.");
+
+	firstEngine.SetMaximumEngineSpeed(-1.0);
+	ExpectedValue(firstEngine.GetSpecification().get(), specification.get(), "Unchanged value should not copy the specification.");
+
+	secondEngine.SetMaximumEngineSpeed(Racecar::RevolutionsMinuteToRadiansSecond(6000.0));
+	ExpectedValue(firstEngine.GetSpecification().get(), specification.get(), "Engine should still share the specification.");
+	ExpectedValue(secondEngine.GetSpecification().get() != specification.get(), true, "Modified engine should have its own specification.");
+
+	const Racecar::EngineSpecification* const ownSpecification(secondEngine.GetSpecification().get());
+	secondEngine.SetMinimumEngineSpeed(Racecar::RevolutionsMinuteToRadiansSecond(1000.0));
+	ExpectedValue(secondEngine.GetSpecification().get(), ownSpecification, "Engine should modify its own copy in place.");
+	ExpectedValue(secondEngine.GetSpecification()->mMinimumEngineSpeed, Racecar::RevolutionsMinuteToRadiansSecond(1000.0),
+		"Engine should keep both modifications.");
+
+	ExpectedValue(specification->mMaximumEngineSpeed, -1.0, "Shared specification should be unchanged.");
+	return ExpectedValue(secondEngine.GetSpecification()->mMaximumEngineSpeed, Racecar::RevolutionsMinuteToRadiansSecond(6000.0),
+		"Engine should use its modified specification.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::EngineAnalyticIntegrationTest(void)
+{
+	Racecar::Engine engine(10.0, Racecar::TorqueCurve::MiataTorqueCurve());
+	engine.SetEngineFrictionResistance(5.0);
+	engine.SetIntegration(Racecar::EngineIntegration::AnalyticWhenDecoupled);
+	engine.SetAngularVelocity(500.0);
+
+	Racecar::DoNothingController racecarController;
+	engine.ControllerChange(racecarController); //Closed throttle produces no torque, leaving only friction.
+
+	for (int step = 0; step < 20; ++step)
+	{
+		engine.Simulate(0.05);
+	}
+
+	ExpectedValueWithin(engine.GetAngularVelocity(), 500.0 * exp(-0.5), kTestEpsilon, "Engine should slow exponentially from friction.");
+
+	engine.SetAngularVelocity(500.0);
+	engine.Simulate(5.0);
+	ExpectedValueWithin(engine.GetAngularVelocity(), 500.0 * exp(-2.5), kTestEpsilon, "Engine should remain exact with a large step.");
+
+	{	//With the throttle open a 50ms step within a single cell of the torque map should follow explicit integration
+		//  of 10000 small steps, where one explicit step of the same size drifts from it.
+		Racecar::ProgrammaticController throttleController;
+		throttleController.SetThrottlePosition(0.5f);
+
+		const auto createEngine = [&throttleController](const Racecar::EngineIntegration integration) {
+			std::unique_ptr<Racecar::Engine> throttleEngine(new Racecar::Engine(0.2, Racecar::TorqueCurve::MiataTorqueCurve()));
+			throttleEngine->SetEngineFrictionResistance(0.05);
+			throttleEngine->SetIntegration(integration);
+			throttleEngine->ControllerChange(throttleController);
+			throttleEngine->SetAngularVelocity(500.0);
+			return throttleEngine;
+		};
+
+		std::unique_ptr<Racecar::Engine> analyticEngine(createEngine(Racecar::EngineIntegration::AnalyticWhenDecoupled));
+		std::unique_ptr<Racecar::Engine> explicitEngine(createEngine(Racecar::EngineIntegration::Explicit));
+		std::unique_ptr<Racecar::Engine> smallStepEngine(createEngine(Racecar::EngineIntegration::Explicit));
+		analyticEngine->Simulate(0.05);
+		explicitEngine->Simulate(0.05);
+		for (int step = 0; step < 10000; ++step)
+		{
+			smallStepEngine->Simulate(0.05 / 10000.0);
+		}
+
+		const Real expectedVelocity(smallStepEngine->GetAngularVelocity());
+		ExpectedValue(expectedVelocity > 510.0, true, "Engine should have sped up with the throttle open.");
+		ExpectedValueWithin(analyticEngine->GetAngularVelocity(), expectedVelocity, 0.001, "Engine should follow the small steps with the throttle open.");
+		ExpectedValue(fabs(explicitEngine->GetAngularVelocity() - expectedVelocity) > 0.01, true, "A single explicit step was expected to drift.");
+	}
+
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::EngineAnalyticNeutralTest(void)
+{
+	Racecar::Engine engine(6.0, Racecar::TorqueCurve::MiataTorqueCurve());
+	Racecar::Clutch clutch(4.0, 1000.0, 0.6, 0.4);
+	Racecar::Transmission transmission(1.0, std::vector<Real>{ 3.0, 2.0, 1.0 }, -3.0);
+	engine.SetEngineFrictionResistance(5.0);
+	engine.SetIntegration(Racecar::EngineIntegration::AnalyticWhenDecoupled);
+
+	engine.AddOutputSource(&clutch);
+	clutch.SetInputSource(&engine);
+	clutch.AddOutputSource(&transmission);
+	transmission.SetInputSource(&clutch);
+
+	Racecar::ProgrammaticController racecarController; //Closed throttle, clutch pedal up and the shifter in neutral.
+	engine.ControllerChange(racecarController);
+	clutch.ControllerChange(racecarController);
+	transmission.ControllerChange(racecarController);
+	ExpectedValue(engine.HasDownstreamLoad(), false, "Engaged clutch into neutral should not load the engine.");
+
+	engine.SetAngularVelocity(500.0);
+	clutch.SetAngularVelocity(500.0);
+	engine.Simulate(5.0);
+	ExpectedValueWithin(engine.GetAngularVelocity(), 500.0 * exp(-5.0 * 5.0 / 10.0), kTestEpsilon,
+		"Engine and clutch should slow exactly from friction together.");
+	return ExpectedValueWithin(clutch.GetAngularVelocity(), engine.GetAngularVelocity(), kTestEpsilon, "Engaged clutch should turn with the engine.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::EngineSpeedLimitTest(void)
+{
+	const Real maximumEngineSpeed(Racecar::RevolutionsMinuteToRadiansSecond(6000.0));
+	const Real minimumEngineSpeed(Racecar::RevolutionsMinuteToRadiansSecond(800.0));
+
+	Racecar::Engine engine(0.1, Racecar::TorqueCurve::MiataTorqueCurve());
+	engine.SetEngineFrictionResistance(0.05);
+	engine.SetMaximumEngineSpeed(maximumEngineSpeed);
+	engine.SetMinimumEngineSpeed(minimumEngineSpeed);
+
+	Racecar::ProgrammaticController racecarController;
+	racecarController.SetThrottlePosition(1.0f);
+	engine.ControllerChange(racecarController);
+
+	for (int timer(0); timer < 2000; timer += 10)
+	{
+		engine.Simulate(kTestFixedTimeStep);
+		if (false == ExpectedValue(engine.GetAngularVelocity() <= maximumEngineSpeed, true, "Engine should not pass the rev limiter."))
+		{
+			return false;
+		}
+	}
+
+	ExpectedValue(engine.GetAngularVelocity(), maximumEngineSpeed, "Engine should be held at the rev limiter.");
+
+	racecarController.SetThrottlePosition(0.0f);
+	engine.ControllerChange(racecarController);
+	for (int timer(0); timer < 20000; timer += 10)
+	{
+		engine.Simulate(kTestFixedTimeStep);
+		if (false == ExpectedValue(engine.GetAngularVelocity() >= minimumEngineSpeed, true, "Engine should not fall below idle."))
+		{
+			return false;
+		}
+	}
+
+	return ExpectedValue(engine.GetAngularVelocity(), minimumEngineSpeed, "Engine should be held at idle.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 //bool EnginePowerTest(void);
 
 //--------------------------------------------------------------------------------------------------------------------//
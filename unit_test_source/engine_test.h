@@ -17,6 +17,47 @@ namespace Racecar
 		bool EngineWithConnectionTest(void);
 
 		bool EngineTorqueTest(void);
+
+		///
+		/// @details Checks the resampled lookup table of a TorqueCurve with only a few plotted points, including engine
+		///   speeds outside of the plotted range, and that the batched lookup matches the single lookup.
+		///
+		bool EngineTorqueCurveLookupTest(void);
+
+		///
+		/// @details Checks a TorqueMap with part throttle curves interpolates between throttle positions, and that an Engine
+		///   using the map produces the part throttle torque rather than a percentage of full throttle torque.
+		///
+		bool EngineTorqueMapTest(void);
+
+		///
+		/// @details Checks a TorqueCurve built at compile time matches the same curve built at runtime.
+		///
+		bool EngineConstexprTorqueCurveTest(void);
+
+		///
+		/// @details Checks engines created from the same specification share it, and that changing the specification of
+		///   one engine does not change the other, copying it once and only when a value actually changes.
+		///
+		bool EngineSharedSpecificationTest(void);
+
+		///
+		/// @details Checks a free-revving engine using EngineIntegration::AnalyticWhenDecoupled slows from friction
+		///   resistance exactly, both with small steps and with a single step far too large for the explicit integration,
+		///   then with the throttle open follows explicit integration of many small steps.
+		///
+		bool EngineAnalyticIntegrationTest(void);
+
+		///
+		/// @details Checks an engine with the clutch engaged and the transmission in neutral is still decoupled, slowing
+		///   exactly from friction resistance over the inertia of both the engine and the clutch.
+		///
+		bool EngineAnalyticNeutralTest(void);
+
+		///
+		/// @details Checks the rev limiter and idle governor hold the engine at the limit without oscillating around it.
+		///
+		bool EngineSpeedLimitTest(void);
 		bool EnginePowerTest(void);
 	};
 };
@@ -13,9 +13,19 @@
 #include "../source/racecar_controller.h"
 #include "../source/racecar_body.h"
 #include "../source/racecar_wheel.h"
+#include "../source/racecar_suspension.h"
+#include "../source/racecar_planar_dynamics.h"
+#include "../source/racecar_track_profile.h"
 #include "../source/racecar_engine.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
 #include <string>
+#include <vector>
 #include <fstream>
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -484,3 +494,367 @@ bool Racecar::UnitTests::FlyingCarHitsTrack(void)
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+
+bool Racecar::UnitTests::FourWheelsHitTrackTogether(void)
+{
+	const std::array<Real, 4> wheelSpeeds{ 40.0, 20.0, 0.0, -8.0 }; //rad/s
+
+	//Runs a car with the wheels in the given slots for a number of steps, the first wheel can grip differently to the rest.
+	auto simulateTouchdown = [&wheelSpeeds](const std::array<size_t, 4>& wheelSlots, const Real& firstFriction,
+		const Real& otherFriction, const size_t steps, std::array<Real, 4>& finalWheelSpeeds) {
+		Racecar::DoNothingController racecarController;
+		Racecar::RacecarBody racecarBody(92.0);
+		std::array<Racecar::Wheel, 4> wheels{ Wheel(8.0, 0.25), Wheel(8.0, 0.25), Wheel(8.0, 0.25), Wheel(8.0, 0.25) };
+
+		racecarBody.SetLinearVelocity(1.0);
+		for (size_t wheelIndex(0); wheelIndex < wheels.size(); ++wheelIndex)
+		{
+			racecarBody.SetWheel(wheelSlots[wheelIndex], &wheels[wheelIndex]);
+			wheels[wheelIndex].SetRacecarBody(&racecarBody);
+			wheels[wheelIndex].SetLinearVelocity(1.0);
+			wheels[wheelIndex].SetAngularVelocity(wheelSpeeds[wheelIndex]);
+			wheels[wheelIndex].SetOnGround(true, (0 == wheelIndex) ? firstFriction : otherFriction);
+		}
+
+		for (size_t step(0); step < steps; ++step)
+		{
+			for (Wheel& wheel : wheels)
+			{
+				wheel.ControllerChange(racecarController);
+				wheel.Simulate(kTestFixedTimeStep);
+			}
+
+			racecarBody.ControllerChange(racecarController);
+			racecarBody.Simulate(kTestFixedTimeStep);
+		}
+
+		for (size_t wheelIndex(0); wheelIndex < wheels.size(); ++wheelIndex)
+		{
+			finalWheelSpeeds[wheelIndex] = wheels[wheelIndex].GetAngularVelocity();
+		}
+
+		return racecarBody.GetLinearVelocity();
+	};
+
+	{	//The momentum  m * v + sum(I / r * w) = 124 * 1 + 2 * 52 = 228  is shared by the 124kg car and the 4 * 8kg of
+		//reflected wheel inertia, so every wheel rolls with the car at 228 / 156 m/s.
+		std::array<Real, 4> finalWheelSpeeds;
+		const Real linearVelocity(simulateTouchdown({ 0, 1, 2, 3 }, Wheel::kInfiniteFriction, Wheel::kInfiniteFriction, 1, finalWheelSpeeds));
+		ExpectedValueWithin(linearVelocity, 228.0 / 156.0, kTestEpsilon, "Four wheel contact did not conserve momentum.");
+		for (const Real& wheelSpeed : finalWheelSpeeds)
+		{
+			ExpectedValueWithin(wheelSpeed * 0.25, linearVelocity, kTestEpsilon, "Each wheel should roll with the car.");
+		}
+	}
+
+	{	//With one wheel on infinite friction and the rest sliding, the wheels in reversed slots should end identically.
+		std::array<Real, 4> finalWheelSpeeds;
+		std::array<Real, 4> reversedWheelSpeeds;
+		const Real linearVelocity(simulateTouchdown({ 0, 1, 2, 3 }, Wheel::kInfiniteFriction, 0.7, 5, finalWheelSpeeds));
+		const Real reversedLinearVelocity(simulateTouchdown({ 3, 2, 1, 0 }, Wheel::kInfiniteFriction, 0.7, 5, reversedWheelSpeeds));
+		ExpectedValueWithin(reversedLinearVelocity, linearVelocity, kTestEpsilon, "Contact solve depends on the wheel order.");
+		for (size_t wheelIndex(0); wheelIndex < finalWheelSpeeds.size(); ++wheelIndex)
+		{
+			ExpectedValueWithin(reversedWheelSpeeds[wheelIndex], finalWheelSpeeds[wheelIndex], kTestEpsilon, "Contact solve depends on the wheel order.");
+		}
+
+		ExpectedValueWithin(finalWheelSpeeds[0] * 0.25, linearVelocity, kTestEpsilon, "The gripping wheel should roll with the car.");
+		ExpectedValue(fabs(finalWheelSpeeds[1] * 0.25 - linearVelocity) >= kTestEpsilon, true, "The fast sliding wheel should still be slipping.");
+	}
+
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::RacecarBodyOwnsLinearMotion(void)
+{
+	Racecar::RacecarBody racecarBody(92.0);
+	Racecar::Wheel frontWheel(8.0, 0.25);
+	Racecar::Wheel rearWheel(10.0, 0.25);
+	ExpectedValueWithin(racecarBody.GetTotalMass(), 92.0, kTestEpsilon, "Body without wheels should have only its own mass.");
+
+	frontWheel.SetLinearVelocity(3.0);
+	racecarBody.SetWheel(0, &frontWheel);
+	frontWheel.SetRacecarBody(&racecarBody);
+	racecarBody.SetWheel(2, &rearWheel);
+	rearWheel.SetRacecarBody(&racecarBody);
+	ExpectedValueWithin(racecarBody.GetTotalMass(), 110.0, kTestEpsilon, "Total mass should include each attached wheel.");
+
+	racecarBody.SetWheel(2, nullptr);
+	ExpectedValueWithin(racecarBody.GetTotalMass(), 100.0, kTestEpsilon, "Total mass should drop a detached wheel.");
+	racecarBody.SetWheel(2, &rearWheel);
+
+	//The wheels follow the body from the moment they are attached, and setting either changes the one value.
+	ExpectedValueWithin(frontWheel.GetLinearVelocity(), 0.0, kTestEpsilon, "Attached wheel should read the body velocity.");
+	racecarBody.ApplyLinearImpulse(220.0);
+	ExpectedValueWithin(racecarBody.GetLinearVelocity(), 2.0, kTestEpsilon, "Impulse should move the total mass.");
+	ExpectedValueWithin(frontWheel.GetLinearVelocity(), 2.0, kTestEpsilon, "Attached wheel should read the body velocity.");
+	ExpectedValueWithin(rearWheel.GetLinearVelocity(), 2.0, kTestEpsilon, "Attached wheel should read the body velocity.");
+
+	rearWheel.SetLinearVelocity(5.0);
+	ExpectedValueWithin(racecarBody.GetLinearVelocity(), 5.0, kTestEpsilon, "Setting an attached wheel should set the body.");
+	return ExpectedValueWithin(frontWheel.GetLinearVelocity(), 5.0, kTestEpsilon, "Every attached wheel should share the body velocity.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::SuspensionLoadTransferTest(void)
+{
+	const Real acceleration(4.0); //meters / second^2
+	const Real weight(Racecar::GetGravityConstant() * 1040.0);
+	const Real transferLoad(1040.0 * acceleration * 0.5 / 2.5 / 2.0); //Newtons at each corner.
+
+	{	//Pushing the body along each step, with the wheels in the air so nothing else changes the speed.
+		Racecar::RacecarBody racecarBody(1000.0);
+		std::array<Racecar::Wheel, 4> wheels{ Wheel(10.0, 0.3), Wheel(10.0, 0.3), Wheel(10.0, 0.3), Wheel(10.0, 0.3) };
+		for (size_t wheelIndex(0); wheelIndex < wheels.size(); ++wheelIndex)
+		{
+			racecarBody.SetWheel(wheelIndex, &wheels[wheelIndex]);
+			wheels[wheelIndex].SetRacecarBody(&racecarBody);
+		}
+
+		racecarBody.SetSuspension(std::make_shared<const SuspensionSpecification>(40000.0, 3000.0, 0.5, 2.5, 0.5));
+		for (size_t step(0); step < 300; ++step)
+		{
+			racecarBody.ApplyLinearImpulse(racecarBody.GetTotalMass() * acceleration * kTestFixedTimeStep);
+			racecarBody.Simulate(kTestFixedTimeStep);
+		}
+
+		const Suspension& suspension(*racecarBody.GetSuspension());
+		ExpectedValueWithin(racecarBody.GetLongitudinalAcceleration(), acceleration, kTestEpsilon, "Body did not track the acceleration.");
+		ExpectedValueWithin(suspension.GetNormalLoad(0), weight / 4.0 - transferLoad, 0.01, "Front left should lose the load transfer.");
+		ExpectedValueWithin(suspension.GetNormalLoad(1), weight / 4.0 - transferLoad, 0.01, "Front right should lose the load transfer.");
+		ExpectedValueWithin(suspension.GetNormalLoad(2), weight / 4.0 + transferLoad, 0.01, "Rear left should gain the load transfer.");
+		ExpectedValueWithin(suspension.GetNormalLoad(3), weight / 4.0 + transferLoad, 0.01, "Rear right should gain the load transfer.");
+		ExpectedValueWithin(suspension.GetDeflection(2), transferLoad / 40000.0, 0.00001, "Rear spring did not compress to hold the load.");
+
+		racecarBody.SetSuspension(nullptr);
+		ExpectedValue(nullptr == racecarBody.GetSuspension(), true, "Suspension should have been removed.");
+	}
+
+	{	//A spring this stiff without any damping would gain energy every step with explicit integration at 10ms.
+		Racecar::Suspension suspension(std::make_shared<const SuspensionSpecification>(5000000.0, 0.0, 0.5, 2.5, 0.5));
+		Real largestLoad(0.0);
+		for (size_t step(0); step < 500; ++step)
+		{
+			suspension.Simulate(acceleration, 1040.0, kTestFixedTimeStep);
+			for (size_t cornerIndex(0); cornerIndex < Suspension::kNumberOfCorners; ++cornerIndex)
+			{
+				largestLoad = std::max(largestLoad, suspension.GetNormalLoad(cornerIndex));
+			}
+		}
+
+		ExpectedValue(largestLoad <= weight / 4.0 + 2.0 * transferLoad, true, "Stiff suspension overshot, the integration is not stable.");
+		ExpectedValueWithin(suspension.GetNormalLoad(3), weight / 4.0 + transferLoad, 0.01, "Stiff suspension did not settle.");
+		ExpectedValueWithin(suspension.GetNormalLoad(0) + suspension.GetNormalLoad(1) + suspension.GetNormalLoad(2) +
+			suspension.GetNormalLoad(3), weight, 0.01, "Suspension should carry the weight of the racecar.");
+	}
+
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::PlanarDynamicsTest(void)
+{
+	const Real weight(Racecar::GetGravityConstant() * 1000.0);
+	const std::array<Real, 4> evenLoads{ weight / 4.0, weight / 4.0, weight / 4.0, weight / 4.0 };
+	const std::shared_ptr<const PlanarDynamicsSpecification> specification(
+		std::make_shared<const PlanarDynamicsSpecification>(1500.0, 2.5, 0.5, 0.1, 80000.0));
+
+	//Runs the racecar at a steady forward speed, returning the total lateral force of the last step.
+	auto simulateSteady = [&evenLoads](PlanarDynamics& planarDynamics, const Real& forwardSpeed, const Real& steering,
+		const Real& gripLimit, const size_t steps) {
+		const std::array<Real, 4> gripLimits{ gripLimit, gripLimit, gripLimit, gripLimit };
+		for (size_t step(0); step < steps; ++step)
+		{
+			Real longitudinalVelocity(forwardSpeed);
+			planarDynamics.Simulate(longitudinalVelocity, steering, 1000.0, evenLoads, gripLimits, kTestFixedTimeStep);
+		}
+
+		return planarDynamics.GetLateralForce(0) + planarDynamics.GetLateralForce(1) +
+			planarDynamics.GetLateralForce(2) + planarDynamics.GetLateralForce(3);
+	};
+
+	{	//Driving straight should leave the racecar on the x axis.
+		PlanarDynamics planarDynamics(specification);
+		simulateSteady(planarDynamics, 10.0, 0.0, 1.0, 100);
+		ExpectedValueWithin(planarDynamics.GetPositionX(), 10.0, kTestEpsilon, "Racecar should have driven 10 meters straight.");
+		ExpectedValueWithin(planarDynamics.GetPositionY(), 0.0, kTestEpsilon, "Racecar should not have moved sideways.");
+		ExpectedValueWithin(planarDynamics.GetHeading(), 0.0, kTestEpsilon, "Racecar should not have turned.");
+	}
+
+	{	//With the weight and tires even front to rear the racecar is neutral, and turns at  r = u * steer / L.
+		PlanarDynamics planarDynamics(specification);
+		const Real lateralForce(simulateSteady(planarDynamics, 10.0, 0.5, 1.0, 500));
+		ExpectedValueWithin(planarDynamics.GetYawRate(), -10.0 * 0.05 / 2.5, kTestEpsilon, "Neutral racecar should turn at the kinematic yaw rate.");
+		ExpectedValueWithin(lateralForce, 1000.0 * 10.0 * planarDynamics.GetYawRate(), 0.01, "Lateral force should hold the racecar on the circle.");
+		ExpectedValue(planarDynamics.GetPositionY() < 0.0, true, "Steering right should turn the racecar to the right.");
+	}
+
+	{	//On ice the tires cannot hold the racecar on the circle, so the lateral force stops at the grip.
+		PlanarDynamics planarDynamics(specification);
+		const Real lateralForce(simulateSteady(planarDynamics, 20.0, 1.0, 0.1, 200));
+		ExpectedValue(fabs(lateralForce) <= 0.1 * weight + 0.01, true, "Lateral force went beyond the grip of the ground.");
+		ExpectedValue(fabs(planarDynamics.GetYawRate()) < 20.0 * 0.1 / 2.5, true, "Racecar should have slid wide of the kinematic yaw rate.");
+	}
+
+	{	//Stiff tires near a standstill would oscillate with explicit integration at 10ms.
+		PlanarDynamics planarDynamics(specification);
+		simulateSteady(planarDynamics, 0.2, 1.0, Wheel::kInfiniteFriction, 500);
+		ExpectedValueWithin(planarDynamics.GetYawRate(), 0.2 * -0.1 / 2.5, 0.001, "Slow racecar should settle at the kinematic yaw rate.");
+		ExpectedValue(fabs(planarDynamics.GetLateralVelocity()) <= 0.2, true, "Slow racecar should not slide sideways faster than it drives.");
+	}
+
+	{	//The RacecarBody steers from the controller and moves the planar dynamics with each step.
+		Racecar::ProgrammaticController racecarController;
+		Racecar::RacecarBody racecarBody(960.0);
+		std::array<Racecar::Wheel, 4> wheels{ Wheel(10.0, 0.3), Wheel(10.0, 0.3), Wheel(10.0, 0.3), Wheel(10.0, 0.3) };
+		for (size_t wheelIndex(0); wheelIndex < wheels.size(); ++wheelIndex)
+		{
+			racecarBody.SetWheel(wheelIndex, &wheels[wheelIndex]);
+			wheels[wheelIndex].SetRacecarBody(&racecarBody);
+			wheels[wheelIndex].SetOnGround(true, Wheel::kInfiniteFriction);
+		}
+
+		racecarBody.SetPlanarDynamics(specification);
+		racecarBody.SetLinearVelocity(10.0);
+		racecarController.SetSteeringPosition(-0.5f);
+		racecarController.UpdateControls();
+		for (size_t step(0); step < 100; ++step)
+		{
+			for (Wheel& wheel : wheels)
+			{
+				wheel.SetAngularVelocity(racecarBody.GetLinearVelocity() / wheel.GetRadius());
+				wheel.ControllerChange(racecarController);
+				wheel.Simulate(kTestFixedTimeStep);
+			}
+
+			racecarBody.ControllerChange(racecarController);
+			racecarBody.Simulate(kTestFixedTimeStep);
+		}
+
+		const PlanarDynamics& planarDynamics(*racecarBody.GetPlanarDynamics());
+		ExpectedValue(planarDynamics.GetHeading() > 0.0 && planarDynamics.GetPositionY() > 0.0, true, "Steering left should turn the racecar to the left.");
+		ExpectedValue(racecarBody.GetLinearVelocity() < 10.0, true, "The steered tires should slow the racecar.");
+	}
+
+	{	//Without wheels on the ground nothing can push the racecar sideways, with no wheels or with them all airborne.
+		for (size_t wheelCount(0); wheelCount <= 4; wheelCount += 4)
+		{
+			Racecar::ProgrammaticController racecarController;
+			Racecar::RacecarBody racecarBody(960.0);
+			std::array<Racecar::Wheel, 4> wheels{ Wheel(10.0, 0.3), Wheel(10.0, 0.3), Wheel(10.0, 0.3), Wheel(10.0, 0.3) };
+			for (size_t wheelIndex(0); wheelIndex < wheelCount; ++wheelIndex)
+			{
+				racecarBody.SetWheel(wheelIndex, &wheels[wheelIndex]);
+				wheels[wheelIndex].SetRacecarBody(&racecarBody);
+				wheels[wheelIndex].SetOnGround(false, Wheel::kInfiniteFriction);
+			}
+
+			racecarBody.SetPlanarDynamics(specification);
+			racecarBody.SetLinearVelocity(20.0);
+			racecarController.SetSteeringPosition(1.0f);
+			for (size_t step(0); step < 100; ++step)
+			{
+				racecarBody.ControllerChange(racecarController);
+				racecarBody.Simulate(kTestFixedTimeStep);
+			}
+
+			const PlanarDynamics& planarDynamics(*racecarBody.GetPlanarDynamics());
+			ExpectedValueWithin(planarDynamics.GetHeading(), 0.0, kTestEpsilon, "Racecar without grounded wheels should not turn.");
+			ExpectedValueWithin(planarDynamics.GetLateralForce(0), 0.0, kTestEpsilon, "Racecar without grounded wheels has no lateral force.");
+			ExpectedValueWithin(racecarBody.GetLinearVelocity(), 20.0, kTestEpsilon, "Racecar without grounded wheels should not slow.");
+		}
+	}
+
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::TrackProfileTest(void)
+{
+	//Ten kilometers with a 10% climb over the first 100 meters, then flat, turning tighter all the way along.
+	std::vector<TrackSample> samples(10001);
+	for (size_t sampleIndex(0); sampleIndex < samples.size(); ++sampleIndex)
+	{
+		samples[sampleIndex].mElevation = static_cast<float>(0.1 * std::min(sampleIndex, size_t(100)));
+		samples[sampleIndex].mCurvature = static_cast<float>(0.0001 * sampleIndex);
+	}
+
+	std::shared_ptr<TrackProfile> trackProfile(std::make_shared<TrackProfile>(samples, 1.0));
+	ExpectedValueWithin(trackProfile->GetLength(), 10000.0, kTestEpsilon, "Track should be ten kilometers long.");
+	ExpectedValueWithin(trackProfile->GetElevation(50.5), 5.05, kTestEpsilon, "Expected elevation between the samples.");
+	ExpectedValueWithin(trackProfile->GetGrade(50.5), 0.1, kTestEpsilon, "Expected a 10% grade on the climb.");
+	ExpectedValueWithin(trackProfile->GetGrade(150.0), 0.0, kTestEpsilon, "Expected the track to be flat after the climb.");
+	ExpectedValueWithin(trackProfile->GetGrade(-5.0), 0.0, kTestEpsilon, "Expected the track to be flat before the start.");
+	ExpectedValueWithin(trackProfile->GetElevation(20000.0), 10.0, kTestEpsilon, "Expected the last elevation beyond the end.");
+	ExpectedValueWithin(trackProfile->GetCurvature(2000.5), 0.20005, 0.00001, "Expected curvature between the samples.");
+
+	{	//Streaming holds only a window of the samples, so jumping around the track reads new windows from the file.
+		const std::string filePath("track_profile_test.rtp");
+		trackProfile->SaveToFile(filePath);
+		std::unique_ptr<TrackProfile> streamedProfile(TrackProfile::OpenFile(filePath));
+		const std::string copiedPath("track_profile_copy_test.rtp");
+		streamedProfile->SaveToFile(copiedPath);
+		std::unique_ptr<TrackProfile> copiedProfile(TrackProfile::OpenFile(copiedPath));
+		std::remove(filePath.c_str());
+		std::remove(copiedPath.c_str());
+
+		std::vector<uint8_t> fileData(sizeof(TrackProfile::TrackProfileHeader) + samples.size() * sizeof(TrackSample));
+		TrackProfile::TrackProfileHeader header{ TrackProfile::kFileIdentifier, static_cast<uint32_t>(samples.size()), 1.0f, 0 };
+		memcpy(fileData.data(), &header, sizeof(header));
+		memcpy(fileData.data() + sizeof(header), samples.data(), samples.size() * sizeof(TrackSample));
+		TrackProfile viewedProfile(fileData.data(), fileData.size());
+
+		for (const Real distance : { 9000.25, 10.5, 5000.75, 4095.5, 4096.5, 9999.9, 99.5, 3000.0 })
+		{
+			const Real elevation(trackProfile->GetElevation(distance));
+			const Real curvature(trackProfile->GetCurvature(distance));
+			ExpectedValueWithin(streamedProfile->GetElevation(distance), elevation, kTestEpsilon, "Streamed elevation did not match.");
+			ExpectedValueWithin(streamedProfile->GetCurvature(distance), curvature, kTestEpsilon, "Streamed curvature did not match.");
+			ExpectedValueWithin(copiedProfile->GetCurvature(distance), curvature, kTestEpsilon, "Copied curvature did not match.");
+			ExpectedValueWithin(viewedProfile.GetCurvature(distance), curvature, kTestEpsilon, "Viewed curvature did not match.");
+		}
+	}
+
+	//A racecar on the climb with the brakes held, then released, returns the velocity it ends with.
+	auto simulateHillStart = [&trackProfile](const float brakePosition, Real& distanceTravelled) {
+		Racecar::ProgrammaticController racecarController;
+		Racecar::RacecarBody racecarBody(990.0);
+		Racecar::Wheel wheel(10.0, 0.3);
+		racecarBody.SetWheel(0, &wheel);
+		wheel.SetRacecarBody(&racecarBody);
+		wheel.SetMaximumBrakingTorque(2000.0);
+		wheel.SetOnGround(true, Wheel::kInfiniteFriction);
+		racecarBody.SetTrackProfile(trackProfile);
+		racecarBody.SetDistanceTravelled(50.0);
+
+		racecarController.SetBrakePosition(brakePosition);
+		racecarController.UpdateControls();
+		for (size_t step(0); step < 100; ++step)
+		{
+			wheel.ControllerChange(racecarController);
+			wheel.Simulate(kTestFixedTimeStep);
+			racecarBody.ControllerChange(racecarController);
+			racecarBody.Simulate(kTestFixedTimeStep);
+		}
+
+		distanceTravelled = racecarBody.GetDistanceTravelled();
+		return racecarBody.GetLinearVelocity();
+	};
+
+	//Rolling freely the 1000kg racecar and the 10kg of reflected wheel inertia are pulled by the slope. The brakes act
+	//after the slope pulls on the racecar each step, so the held racecar does not move at all.
+	Real distanceTravelled(0.0);
+	const Real slopeAcceleration(Racecar::GetGravityConstant() * 0.1 / sqrt(1.01) * 1000.0 / 1010.0);
+	ExpectedValue(simulateHillStart(1.0f, distanceTravelled), 0.0, "Brakes should hold the racecar on the hill.");
+	ExpectedValue(distanceTravelled, 50.0, "Brakes should hold the racecar on the hill.");
+	ExpectedValueWithin(simulateHillStart(0.0f, distanceTravelled), -slopeAcceleration, 0.0001, "Racecar should roll back down the hill.");
+	ExpectedValue(distanceTravelled <= 49.6, true, "Racecar should have rolled back down the hill.");
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
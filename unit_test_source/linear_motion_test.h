@@ -46,6 +46,37 @@ namespace Racecar
 		///   spinning while taking some of the momentum away from the car.
 		///
 		bool FlyingCarHitsTrack(void);
+
+		///
+		/// All four wheels of a car touch down spinning at different speeds. The contacts are solved together, so with
+		///   infinite friction every wheel rolls with the car after one step with the momentum shared between them, and
+		///   the result does not depend on which slot of the car each wheel is in.
+		///
+		bool FourWheelsHitTrackTogether(void);
+
+		///
+		/// The body keeps the total mass as wheels are attached, and is the only owner of the linear velocity that each
+		///   attached wheel reads, while a loose wheel keeps its own.
+		///
+		bool RacecarBodyOwnsLinearMotion(void);
+
+		///
+		/// Accelerating the racecar should move load from the front corners of the suspension to the rear by
+		///   m * a * h / L  while the total load stays the weight, even for a spring too stiff for explicit integration.
+		///
+		bool SuspensionLoadTransferTest(void);
+
+		///
+		/// A steered racecar should turn at the kinematic yaw rate when neutral, hold no more lateral force than the grip
+		///   of the ground allows, stay settled when steered near a standstill, and turn the way it was steered.
+		///
+		bool PlanarDynamicsTest(void);
+
+		///
+		/// A track profile should give the same elevation, grade and curvature from memory, viewed in place or streamed
+		///   from a file, and a racecar on the slope should roll back down it unless the brakes hold it.
+		///
+		bool TrackProfileTest(void);
 	};
 };
 
@@ -11,15 +11,44 @@
 
 #include "../source/racecar.h"
 #include "../source/racecar_controller.h"
+#include "../source/racecar_controller_queue.h"
 #include "../source/racecar_engine.h"
 #include "../source/racecar_clutch.h"
 #include "../source/racecar_transmission.h"
 #include "../source/racecar_locked_differential.h"
 #include "../source/racecar_wheel.h"
 #include "../source/racecar_body.h"
+#include "../source/racecar_drivetrain.h"
 
 #include <array>
 #include <fstream>
+#include <memory>
+#include <new>
+#include <thread>
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace
+{
+	class ControllerChangeCounter : public Racecar::RotatingBody
+	{
+	public:
+		explicit ControllerChangeCounter(const Racecar::ControllerChannels channels) :
+			Racecar::RotatingBody(1.0, channels),
+			mNumberOfChanges(0)
+		{
+		}
+
+		size_t mNumberOfChanges;
+
+	protected:
+		virtual void OnControllerChange(const Racecar::RacecarControllerInterface& racecarController) override
+		{
+			((void)racecarController);
+			++mNumberOfChanges;
+		}
+	};
+};
 
 //--------------------------------------------------------------------------------------------------------------------//
 
@@ -465,3 +494,170 @@ bool Racecar::UnitTests::RacecarReverseTest(void)
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::ControllerEventQueueTest(void)
+{
+	{
+		ControllerEventQueue eventQueue(5);
+		ExpectedValue(eventQueue.GetCapacity(), size_t(8), "Capacity should round up to a power of two.");
+		for (size_t eventIndex(0); eventIndex < eventQueue.GetCapacity(); ++eventIndex)
+		{
+			ExpectedValue(eventQueue.Push(ControllerEvent(0.0, ControllerInput::Throttle, 0.0f)), true, "Queue should have room.");
+		}
+
+		ExpectedValue(eventQueue.Push(ControllerEvent(0.0, ControllerInput::Throttle, 0.0f)), false, "Queue should be full.");
+	}
+
+	{	//One thread produces while this one consumes, every event must arrive once and in order.
+		const size_t numberOfEvents(100000);
+		ControllerEventQueue eventQueue(64);
+		std::thread producer([&eventQueue, numberOfEvents]() {
+			for (size_t eventIndex(0); eventIndex < numberOfEvents; ++eventIndex)
+			{
+				while (false == eventQueue.Push(ControllerEvent(static_cast<Real>(eventIndex), ControllerInput::Steering, 0.0f)))
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+
+		size_t numberOfOutOfOrder(0);
+		ControllerEvent controllerEvent;
+		for (size_t eventIndex(0); eventIndex < numberOfEvents; )
+		{
+			if (true == eventQueue.Pop(controllerEvent))
+			{
+				numberOfOutOfOrder += (controllerEvent.mTime == static_cast<Real>(eventIndex)) ? 0 : 1;
+				++eventIndex;
+			}
+		}
+
+		producer.join();
+		ExpectedValue(numberOfOutOfOrder, size_t(0), "Events were lost or reordered between threads.");
+		ExpectedValue(eventQueue.Pop(controllerEvent), false, "Queue should be empty.");
+	}
+
+	{	//Each event applies from the start of the time step it happened within, a quick shift press is held for the step.
+		ControllerEventQueue eventQueue;
+		QueuedController racecarController(eventQueue);
+		eventQueue.Push(ControllerEvent(0.005, ControllerInput::Throttle, 0.5f));
+		eventQueue.Push(ControllerEvent(0.012, ControllerInput::Upshift, 1.0f));
+		eventQueue.Push(ControllerEvent(0.013, ControllerInput::Upshift, 0.0f));
+		eventQueue.Push(ControllerEvent(0.015, ControllerInput::Brake, 1.0f));
+		eventQueue.Push(ControllerEvent(0.016, Gear::Second));
+		eventQueue.Push(ControllerEvent(0.02, ControllerInput::Clutch, 1.0f));
+
+		racecarController.SetTimeStep(0.0, kTestFixedTimeStep);
+		racecarController.UpdateControls();
+		ExpectedValue(racecarController.GetThrottlePosition(), 0.5f, "Throttle should change for the step it happened within.");
+		ExpectedValue(racecarController.IsUpshift(), false, "Upshift pressed before the step of its event.");
+
+		racecarController.SetTimeStep(kTestFixedTimeStep, kTestFixedTimeStep);
+		racecarController.UpdateControls();
+		ExpectedValue(racecarController.IsUpshift(), true, "A quick upshift press should be held for the step it happened within.");
+		ExpectedValue(racecarController.GetBrakePosition(), 1.0f, "Brake should not wait behind the upshift release.");
+		ExpectedValue(racecarController.GetShifterPosition(), Gear::Second, "Shifter should not wait behind the upshift release.");
+		ExpectedValue(racecarController.GetClutchPosition(), 0.0f, "Clutch changed before the step of its event.");
+
+		racecarController.SetTimeStep(2.0 * kTestFixedTimeStep, kTestFixedTimeStep);
+		racecarController.UpdateControls();
+		ExpectedValue(racecarController.IsUpshift(), false, "Upshift should be released.");
+		ExpectedValue(racecarController.GetClutchPosition(), 1.0f, "Clutch should change at the start of its step.");
+	}
+
+	{	//Interpolating follows the steering between events rather than holding it until the next event.
+		ControllerEventQueue eventQueue;
+		QueuedController racecarController(eventQueue, true);
+		eventQueue.Push(ControllerEvent(0.0, ControllerInput::Steering, -1.0f));
+		eventQueue.Push(ControllerEvent(0.1, ControllerInput::Throttle, 1.0f));
+		eventQueue.Push(ControllerEvent(0.1, ControllerInput::Steering, 1.0f));
+
+		racecarController.SetTimeStep(0.025, kTestFixedTimeStep);
+		racecarController.UpdateControls();
+		ExpectedValueWithin(racecarController.GetSteeringPosition(), -0.5f, kTestEpsilon, "Steering should be interpolated.");
+		ExpectedValueWithin(racecarController.GetThrottlePosition(), 0.25f, kTestEpsilon, "Throttle should be interpolated.");
+
+		racecarController.SetTimeStep(0.2, kTestFixedTimeStep);
+		racecarController.UpdateControls();
+		ExpectedValueWithin(racecarController.GetSteeringPosition(), 1.0f, kTestEpsilon, "Steering should reach its last event.");
+	}
+
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::ControllerChannelTest(void)
+{
+	ProgrammaticController racecarController;
+	ExpectedValue(racecarController.GetChangedChannels(0), kAllControllerChannels, "Every channel should start changed.");
+
+	const uint64_t startChangeCount(racecarController.GetChangeCount());
+	racecarController.SetThrottlePosition(0.0f);
+	ExpectedValue(racecarController.GetChangeCount(), startChangeCount, "Setting the same position is not a change.");
+	racecarController.SetThrottlePosition(0.5f);
+	racecarController.SetUpshift(true);
+	ExpectedValue(racecarController.GetChangedChannels(startChangeCount), ControllerChannels(kThrottleChannel | kShiftButtonChannel),
+		"Expected only the throttle and shift buttons to have changed.");
+
+	ControllerChangeCounter throttleReader(kThrottleChannel);
+	throttleReader.ControllerChange(racecarController);
+	throttleReader.ControllerChange(racecarController);
+	ExpectedValue(throttleReader.mNumberOfChanges, size_t(1), "Nothing changed since the first controller change.");
+
+	racecarController.SetBrakePosition(1.0f);
+	throttleReader.ControllerChange(racecarController);
+	ExpectedValue(throttleReader.mNumberOfChanges, size_t(1), "The brake is not read by the component.");
+
+	racecarController.SetThrottlePosition(1.0f);
+	throttleReader.ControllerChange(racecarController);
+	ExpectedValue(throttleReader.mNumberOfChanges, size_t(2), "The throttle changed.");
+
+	ProgrammaticController otherController(racecarController);
+	throttleReader.ControllerChange(otherController);
+	ExpectedValue(throttleReader.mNumberOfChanges, size_t(3), "A different controller should always count as a change.");
+
+	throttleReader.ResetControllerChanges();
+	throttleReader.ControllerChange(otherController);
+	ExpectedValue(throttleReader.mNumberOfChanges, size_t(4), "A reset should read the controller again.");
+
+	{	//A controller built where another was destroyed is still a different controller.
+		std::unique_ptr<ProgrammaticController> rebuiltController(new ProgrammaticController());
+		rebuiltController->SetThrottlePosition(0.25f);
+		ControllerSubscription subscription(kThrottleChannel);
+		subscription.ConsumeChanges(*rebuiltController);
+
+		ProgrammaticController* const address(rebuiltController.get());
+		address->~ProgrammaticController();
+		new (address) ProgrammaticController();
+		ExpectedValue(subscription.ConsumeChanges(*address), true, "A controller rebuilt at the same address should count as changed.");
+	}
+
+	//The drive-train is returned to neutral and the racecar to the start by the reset, the shifter has not moved but
+	//must be read again.
+	Drivetrain drivetrain(std::make_shared<const DrivetrainSpecification>(
+		std::make_shared<const EngineSpecification>(0.05, TorqueMap::FromTorqueCurve(TorqueCurve::MiataTorqueCurve())),
+		std::make_shared<const ClutchSpecification>(0.04, 10000.0),
+		std::make_shared<const TransmissionSpecification>(0.01, std::vector<Real>{ 3.0, 2.0 }, -3.0),
+		std::make_shared<const DifferentialSpecification>(0.01, 4.0),
+		std::make_shared<const WheelSpecification>(10.0, 0.3), 1000.0));
+	racecarController.SetShifterPosition(Gear::Second);
+	drivetrain.ControllerChange(racecarController);
+	ExpectedValue(drivetrain.GetTransmission().GetSelectedGear(), Gear::Second, "Expected the shifter to select second.");
+
+	drivetrain.SetLinearVelocity(10.0);
+	for (int step(0); step < 10; ++step)
+	{
+		drivetrain.Simulate(kTestFixedTimeStep);
+	}
+	ExpectedValue(drivetrain.GetRacecarBody().GetDistanceTravelled() > 0.5, true, "Expected the racecar to have driven forwards.");
+
+	drivetrain.Reset();
+	ExpectedValue(drivetrain.GetTransmission().GetSelectedGear(), Gear::Neutral, "Reset should return the drive-train to neutral.");
+	ExpectedValue(drivetrain.GetRacecarBody().GetLinearVelocity(), 0.0, "Reset should stop the racecar.");
+	ExpectedValue(drivetrain.GetRacecarBody().GetDistanceTravelled(), 0.0, "Reset should return the racecar to the start.");
+	drivetrain.ControllerChange(racecarController);
+	return ExpectedValue(drivetrain.GetTransmission().GetSelectedGear(), Gear::Second, "Reset should read the shifter again.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
@@ -17,6 +17,19 @@ namespace Racecar
 		bool RacecarZeroToSixtyTest(void);
 
 		bool RacecarReverseTest(void);
+
+		///
+		/// @details Pushes controller events from another thread, checking none are lost or reordered, then checks the
+		///   QueuedController applies each event from the start of the time step it happened within, and follows the
+		///   axes between events when interpolating.
+		///
+		bool ControllerEventQueueTest(void);
+
+		///
+		/// @details Checks a component only handles a controller change when a channel it reads has changed, or the
+		///   controller is a different one, and a reset drive-train reads the unchanged controls again.
+		///
+		bool ControllerChannelTest(void);
 	};
 };
 
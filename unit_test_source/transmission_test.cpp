@@ -14,10 +14,14 @@
 #include "../source/racecar_engine.h"
 #include "../source/racecar_clutch.h"
 #include "../source/racecar_transmission.h"
+#include "../source/racecar_shift_scheduler.h"
+#include "../source/racecar_shift_points.h"
 #include "../source/racecar_wheel.h"
 
 #include <fstream>
 #include <array>
+#include <limits>
+#include <vector>
 
 //--------------------------------------------------------------------------------------------------------------------//
 
@@ -314,3 +318,205 @@ bool Racecar::UnitTests::TransmissionBrakeInReverseTest(void)
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::TransmissionNumberOfGearsTest(void)
+{
+	const std::vector<Racecar::Real> forwardGearRatios{ 4.7, 3.1, 2.1, 1.7, 1.3, 1.0, 0.8, 0.7, 0.6, 0.5 };
+
+	ProgrammaticController racecarController;
+	RotatingBody inputBody(2.0);
+	Transmission gearbox(10.0, forwardGearRatios, -3.8);
+	RotatingBody outputBody(5.0);
+
+	inputBody.AddOutputSource(&gearbox);
+	gearbox.SetInputSource(&inputBody);
+	gearbox.AddOutputSource(&outputBody);
+	outputBody.SetInputSource(&gearbox);
+
+	ExpectedValue(gearbox.GetSpecification()->GetNumberOfForwardGears(), forwardGearRatios.size(), "Expected ten forward gears.");
+
+	auto shiftFunction = [&](bool isUpshift) {
+		racecarController.SetUpshift(isUpshift);
+		racecarController.SetDownshift(!isUpshift);
+		gearbox.ControllerChange(racecarController);
+		racecarController.SetUpshift(false);
+		racecarController.SetDownshift(false);
+		gearbox.ControllerChange(racecarController);
+	};
+
+	for (size_t gear(1); gear <= forwardGearRatios.size(); ++gear)
+	{
+		shiftFunction(true);
+		ExpectedValue(gearbox.GetSelectedGear(), static_cast<Gear>(gear), "Upshift should select the next gear.");
+		ExpectedValueWithin(gearbox.GetSelectedGearRatio(), forwardGearRatios[gear - 1], kTestEpsilon, "Selected the wrong gear ratio.");
+		ExpectedValueWithin(inputBody.ComputeDownstreamInertia(), 2.0 + (10.0 + 5.0) / (forwardGearRatios[gear - 1] * forwardGearRatios[gear - 1]),
+			kTestEpsilon, "Inertia was not reflected through the selected gear.");
+	}
+
+	shiftFunction(true);
+	ExpectedValue(gearbox.GetSelectedGear(), Gear::Tenth, "Upshift should stop at the highest gear.");
+
+	racecarController.SetShifterPosition(Gear::Reverse);
+	gearbox.ControllerChange(racecarController);
+	ExpectedValueWithin(gearbox.GetSelectedGearRatio(), -3.8, kTestEpsilon, "Shifter(Reverse) selected the wrong gear ratio.");
+
+	//A five speed without a reverse gear should ignore shifts into the gears it does not have.
+	const std::array<Racecar::Real, 6> fiveSpeedGearRatios{ 4.0, 3.0, 2.0, 1.0, 0.5, 0.0 };
+	Transmission fiveSpeedGearbox(10.0, fiveSpeedGearRatios, 0.0);
+	ProgrammaticController fiveSpeedController;
+	ExpectedValue(fiveSpeedGearbox.GetSpecification()->GetNumberOfForwardGears(), size_t(5), "Expected five forward gears.");
+	ExpectedValue(fiveSpeedGearbox.GetSpecification()->HasReverseGear(), false, "Expected no reverse gear.");
+
+	fiveSpeedController.SetDownshift(true);
+	fiveSpeedGearbox.ControllerChange(fiveSpeedController);
+	ExpectedValue(fiveSpeedGearbox.GetSelectedGear(), Gear::Neutral, "Downshift should remain in neutral without reverse.");
+
+	fiveSpeedController.SetDownshift(false);
+	fiveSpeedController.SetShifterPosition(Gear::Sixth);
+	fiveSpeedGearbox.ControllerChange(fiveSpeedController);
+	ExpectedValue(fiveSpeedGearbox.GetSelectedGear(), Gear::Neutral, "Shifter(Sixth) should not find a gear in a five speed.");
+
+	fiveSpeedController.SetShifterPosition(Gear::Fifth);
+	fiveSpeedGearbox.ControllerChange(fiveSpeedController);
+	return ExpectedValue(fiveSpeedGearbox.GetSelectedGear(), Gear::Fifth, "Shifter(Fifth) should be in fifth gear.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::ShiftSchedulerTest(void)
+{
+	const std::vector<Racecar::Real> forwardGearRatios{ 3.0, 2.0, 1.5, 1.0 };
+
+	ProgrammaticController racecarController;
+	Transmission gearbox(10.0, forwardGearRatios, -3.0);
+	std::shared_ptr<const ShiftMap> shiftMap(std::make_shared<const ShiftMap>(*gearbox.GetSpecification(), 200.0, 600.0, 0.2));
+	ShiftScheduler shiftScheduler(shiftMap, gearbox);
+
+	auto stepFunction = [&](const Real& outputShaftSpeed) {
+		gearbox.SetAngularVelocity(outputShaftSpeed);
+		shiftScheduler.ControllerChange(racecarController);
+		shiftScheduler.Simulate(kTestFixedTimeStep);
+	};
+
+	racecarController.SetThrottlePosition(1.0f);
+	stepFunction(300.0);
+	ExpectedValue(gearbox.GetSelectedGear(), Gear::Neutral, "ShiftScheduler should not shift out of neutral.");
+
+	//At full throttle first gear upshifts once the engine passes 600 rad/s, which is 200 rad/s on the output shaft.
+	gearbox.SelectGear(Gear::First);
+	ExpectedValueWithin(shiftMap->GetUpshiftSpeed(Gear::First, 1.0f), 200.0, kTestEpsilon, "Wrong upshift speed for first gear.");
+	stepFunction(199.0);
+	ExpectedValue(gearbox.GetSelectedGear(), Gear::First, "ShiftScheduler should hold first below the shift speed.");
+	stepFunction(201.0);
+	ExpectedValue(gearbox.GetSelectedGear(), Gear::Second, "ShiftScheduler should upshift above the shift speed.");
+
+	//Second only downshifts once 20% below where first upshifted.
+	ExpectedValueWithin(shiftMap->GetDownshiftSpeed(Gear::Second, 1.0f), 160.0, kTestEpsilon, "Wrong downshift speed for second gear.");
+	stepFunction(170.0);
+	ExpectedValue(gearbox.GetSelectedGear(), Gear::Second, "ShiftScheduler should hold second within the hysteresis.");
+	stepFunction(150.0);
+	ExpectedValue(gearbox.GetSelectedGear(), Gear::First, "ShiftScheduler should downshift below the hysteresis.");
+
+	//Lifting off the throttle shifts earlier, one gear each step up to the highest gear.
+	racecarController.SetThrottlePosition(0.0f);
+	stepFunction(150.0);
+	ExpectedValue(gearbox.GetSelectedGear(), Gear::Second, "ShiftScheduler should upshift early with light throttle.");
+	stepFunction(150.0);
+	ExpectedValue(gearbox.GetSelectedGear(), Gear::Third, "ShiftScheduler should upshift early with light throttle.");
+	stepFunction(150.0);
+	ExpectedValue(gearbox.GetSelectedGear(), Gear::Fourth, "ShiftScheduler should upshift early with light throttle.");
+	stepFunction(1000.0);
+	return ExpectedValue(gearbox.GetSelectedGear(), Gear::Fourth, "ShiftScheduler should not upshift past the highest gear.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::ShiftPointTableTest(void)
+{
+	const std::vector<Racecar::Real> forwardGearRatios{ 3.136, 1.888, 1.330, 1.000, 0.814 };
+	const Real finalDriveRatio(4.3);
+	const Real wheelRadius(0.3);
+
+	TorqueCurve flatCurve;
+	flatCurve.AddPlotPoint(1000.0, 100.0);
+	flatCurve.AddPlotPoint(7000.0, 100.0);
+	flatCurve.NormalizeTorqueCurve();
+
+	//With a flat curve the lower gear always pulls harder, so every shift waits for the maximum engine speed.
+	const ShiftPointTable flatShiftPoints(flatCurve, forwardGearRatios, finalDriveRatio, wheelRadius, 2);
+	ExpectedValue(flatShiftPoints.GetNumberOfForwardGears(), forwardGearRatios.size(), "Wrong number of forward gears.");
+	for (size_t gearIndex(1); gearIndex < forwardGearRatios.size(); ++gearIndex)
+	{
+		const Gear gear(static_cast<Gear>(gearIndex));
+		ExpectedValueWithin(flatShiftPoints.GetAnalyticShiftRPM(gear), 7000.0, kTestEpsilon, "Flat curve should shift at the maximum engine speed.");
+		ExpectedValueWithin(flatShiftPoints.GetShiftRPM(gear), 7000.0, kTestEpsilon, "Flat curve sweep should shift at the maximum engine speed.");
+	}
+
+	ExpectedValue(flatShiftPoints.ShouldUpshift(Gear::First, 6999.0), false, "Should not upshift below the shift point.");
+	ExpectedValue(flatShiftPoints.ShouldUpshift(Gear::First, 7000.0), true, "Should upshift at the shift point.");
+	ExpectedValue(flatShiftPoints.ShouldUpshift(Gear::Fifth, 100000.0), false, "Should never upshift out of the highest gear.");
+
+	//The Miata torque falls off enough near the redline that each gear shifts before it, and sweeping the shift point
+	//should find a time no slower than the analytic point, which it includes, so they should land close together.
+	const TorqueCurve& miataCurve(TorqueCurve::MiataTorqueCurve());
+	const ShiftPointTable miataShiftPoints(miataCurve, forwardGearRatios, finalDriveRatio, wheelRadius);
+	const ShiftPointTable singleThreadShiftPoints(miataCurve, forwardGearRatios, finalDriveRatio, wheelRadius, 1);
+	const Real sweepTolerance(0.15 * (miataCurve.GetMaximumRPM() - miataCurve.GetMinimumRPM()));
+	for (size_t gearIndex(1); gearIndex < forwardGearRatios.size(); ++gearIndex)
+	{
+		const Gear gear(static_cast<Gear>(gearIndex));
+		const Real analyticShiftRPM(miataShiftPoints.GetAnalyticShiftRPM(gear));
+		const Real shiftRPM(miataShiftPoints.GetShiftRPM(gear));
+		ExpectedValue(analyticShiftRPM >= miataCurve.GetMinimumRPM() && analyticShiftRPM <= miataCurve.GetMaximumRPM(), true, "Analytic shift point is outside the torque curve.");
+		ExpectedValue(shiftRPM < miataCurve.GetMaximumRPM(), true, "Miata should shift before the redline.");
+		ExpectedValueWithin(shiftRPM, analyticShiftRPM, sweepTolerance, "Swept shift point strayed too far from the analytic shift point.");
+		ExpectedValue(singleThreadShiftPoints.GetShiftRPM(gear), shiftRPM, "Shift points should not depend on the number of threads.");
+	}
+
+	return ExpectedValue(miataShiftPoints.GetShiftRPM(Gear::Fifth), std::numeric_limits<Real>::max(), "Highest gear should never shift.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::ShiftMapShiftPointsTest(void)
+{
+	const std::vector<Racecar::Real> forwardGearRatios{ 3.136, 1.888, 1.330, 1.000, 0.814 };
+	const TorqueCurve& miataCurve(TorqueCurve::MiataTorqueCurve());
+	const ShiftPointTable shiftPoints(miataCurve, forwardGearRatios, 4.3, 0.3);
+	const Real redlineSpeed(RevolutionsMinuteToRadiansSecond(miataCurve.GetMaximumRPM()));
+
+	ProgrammaticController racecarController;
+	racecarController.SetThrottlePosition(1.0f);
+	Transmission gearbox(10.0, forwardGearRatios, -3.0);
+	std::shared_ptr<const ShiftMap> shiftMap(std::make_shared<const ShiftMap>(*gearbox.GetSpecification(),
+		RevolutionsMinuteToRadiansSecond(2500.0), shiftPoints, 0.2));
+	ShiftScheduler shiftScheduler(shiftMap, gearbox);
+	gearbox.SelectGear(Gear::First);
+
+	auto stepFunction = [&](const Real& outputShaftSpeed) {
+		gearbox.SetAngularVelocity(outputShaftSpeed);
+		shiftScheduler.ControllerChange(racecarController);
+		shiftScheduler.Simulate(kTestFixedTimeStep);
+	};
+
+	//At full throttle each gear should be held up to the shift point from the table, which is below the redline, and
+	//upshift just past it.
+	for (size_t gearIndex(1); gearIndex < forwardGearRatios.size(); ++gearIndex)
+	{
+		const Gear gear(static_cast<Gear>(gearIndex));
+		const Real gearRatio(forwardGearRatios[gearIndex - 1]);
+		const Real upshiftSpeed(shiftMap->GetUpshiftSpeed(gear, 1.0f));
+		ExpectedValueWithin(upshiftSpeed * gearRatio, RevolutionsMinuteToRadiansSecond(shiftPoints.GetShiftRPM(gear)), kTestEpsilon,
+			"Full throttle should upshift at the shift point from the table.");
+		ExpectedValue(upshiftSpeed * gearRatio < redlineSpeed, true, "ShiftMap should upshift before the redline.");
+
+		stepFunction(upshiftSpeed * 0.99);
+		ExpectedValue(gearbox.GetSelectedGear(), gear, "ShiftScheduler should hold the gear below the shift point.");
+		stepFunction(upshiftSpeed * 1.01);
+		ExpectedValue(gearbox.GetSelectedGear(), static_cast<Gear>(gearIndex + 1), "ShiftScheduler should upshift past the shift point.");
+	}
+
+	return ExpectedValue(shiftMap->GetUpshiftSpeed(Gear::Fifth, 1.0f), std::numeric_limits<Real>::max(), "Highest gear should never upshift.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
@@ -26,6 +26,31 @@ namespace Racecar
 		///   the brakes. Expected: The AngularVelocity of the transmission and wheel to return to 0, and stay matched.
 		///
 		bool TransmissionBrakeInReverseTest(void);
+
+		///
+		/// @details Shifts through a ten speed transmission, and a five speed without reverse, checking the shifts stop
+		///   at the gears that exist and the inertia is reflected through the selected gear.
+		///
+		bool TransmissionNumberOfGearsTest(void);
+
+		///
+		/// @details Runs a ShiftScheduler on a four speed, checking it upshifts at the speeds from the ShiftMap for the
+		///   throttle position, one gear per step, and holds the gear within the hysteresis before downshifting.
+		///
+		bool ShiftSchedulerTest(void);
+
+		///
+		/// @details Computes the shift points of a flat torque curve, which should hold each gear to the maximum engine
+		///   speed, and of the Miata, checking each gear shifts before the redline and the swept shift points agree with
+		///   the analytic ones.
+		///
+		bool ShiftPointTableTest(void);
+
+		///
+		/// @details Builds a ShiftMap from the shift points of the Miata, checking a ShiftScheduler at full throttle holds
+		///   each gear to the shift point from the table and upshifts there, before the redline.
+		///
+		bool ShiftMapShiftPointsTest(void);
 	};
 };
 
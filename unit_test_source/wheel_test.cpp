@@ -12,10 +12,18 @@
 #include "../source/racecar.h"
 #include "../source/racecar_controller.h"
 #include "../source/racecar_wheel.h"
+#include "../source/racecar_body.h"
+#include "../source/racecar_tire_model.h"
+#include "../source/racecar_surface_map.h"
 #include "../source/racecar_engine.h"
 #include "../source/racecar_clutch.h"
 
 #include <array>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
 
 //--------------------------------------------------------------------------------------------------------------------//
 
@@ -375,3 +383,266 @@ bool Racecar::UnitTests::WheelClutchAndEngineBrakingTest(void)
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::TireModelTest(void)
+{
+	const TireSpecification tire(10.0, 1.9, 1.0, 0.97);
+	const auto magicFormula = [&tire](const Real& slipRatio) {
+		const Real stiffSlip(tire.mStiffnessFactor * slipRatio);
+		return tire.mPeakFrictionCoefficient * std::sin(tire.mShapeFactor *
+			std::atan(stiffSlip - tire.mCurvatureFactor * (stiffSlip - std::atan(stiffSlip))));
+	};
+
+	const std::array<Real, 6> slipRatios{ -1.0, -0.12, 0.0, 0.05, 0.12, 1.0 };
+	for (const Real& slipRatio : slipRatios)
+	{
+		ExpectedValueWithin(tire.GetFrictionCoefficient(slipRatio), magicFormula(slipRatio), 0.005, "Tire table does not follow the Magic Formula.");
+	}
+
+	{	//Slipping before, at and after the peak, and beyond both ends of the table, at 10 m/s.
+		const std::array<Real, 7> slipVelocities{ -25.0, -10.0, -1.2, 0.0, 0.5, 1.2, 25.0 };
+		const std::array<Real, 7> normalLoads{ 1000.0, 2000.0, 3000.0, 4000.0, 5000.0, 6000.0, 7000.0 };
+		const std::array<Real, 7> inverseEffectiveMasses{ 0.5, 0.01, 0.1, 0.02, 0.002, 0.01, 0.05 };
+		std::array<Real, 7> contactImpulses;
+		tire.ComputeContactImpulses(slipVelocities.data(), normalLoads.data(), inverseEffectiveMasses.data(),
+			contactImpulses.data(), slipVelocities.size(), 10.0, kTestFixedTimeStep);
+
+		for (size_t tireIndex(0); tireIndex < slipVelocities.size(); ++tireIndex)
+		{
+			ExpectedValue(contactImpulses[tireIndex], tire.ComputeContactImpulse(slipVelocities[tireIndex], 10.0,
+				normalLoads[tireIndex], inverseEffectiveMasses[tireIndex], kTestFixedTimeStep), "Batch tire impulses differ from a single tire.");
+		}
+	}
+
+	ExpectedValueWithin(tire.GetFrictionCoefficient(5.0), tire.GetFrictionCoefficient(TireSpecification::kMaximumSlipRatio), kTestEpsilon, "Slip beyond the table should hold the end of the table.");
+	ExpectedValueWithin(TireSpecification::ComputeSlipRatio(11.0, 10.0), 0.1, kTestEpsilon, "Wrong slip ratio.");
+	ExpectedValueWithin(TireSpecification::ComputeSlipRatio(0.0, 10.0), -1.0, kTestEpsilon, "A locked wheel should have a slip ratio of -1.");
+
+	{	//A wheel spinning at 10 m/s dropped onto the ground is sliding at the end of the table, so the first step pulls
+		//the 100kg racecar along with the sliding friction, then the tire grips until the wheel rolls with the racecar
+		//at the same speeds as infinite friction would reach in a single step.
+		Racecar::DoNothingController racecarController;
+		Racecar::RacecarBody carBody(92.0);
+		Racecar::Wheel wheel(8.0, 0.25);
+		wheel.SetTire(std::make_shared<const TireSpecification>(tire));
+		wheel.SetAngularVelocity(40.0);
+
+		carBody.SetWheel(0, &wheel);
+		wheel.SetRacecarBody(&carBody);
+		wheel.SetOnGround(true, Wheel::kInfiniteFriction);
+
+		wheel.ControllerChange(racecarController);
+		carBody.ControllerChange(racecarController);
+		wheel.Simulate(kTestFixedTimeStep);
+		carBody.Simulate(kTestFixedTimeStep);
+		ExpectedValueWithin(carBody.GetLinearVelocity(), magicFormula(1.0) * 0.1, kTestEpsilon, "Tire should pull with sliding friction.");
+
+		for (int timer(10); timer < 2000; timer += 10)
+		{
+			wheel.ControllerChange(racecarController);
+			carBody.ControllerChange(racecarController);
+			wheel.Simulate(kTestFixedTimeStep);
+			carBody.Simulate(kTestFixedTimeStep);
+		}
+
+		ExpectedValueWithin(wheel.GetAngularVelocity() * wheel.GetRadius(), carBody.GetLinearVelocity(), kTestEpsilon, "Wheel should roll with the racecar.");
+		ExpectedValueWithin(carBody.GetLinearVelocity(), 0.740740740740, kTestEpsilon, "Tire should conserve momentum.");
+	}
+
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::TireLowSpeedStabilityTest(void)
+{
+	const TireSpecification tire;
+
+	{	//The 8kg wheel of 0.25m radius on a 100kg racecar has  k = 0.25^2 / 0.5 + 1 / 100 = 0.135  and the tire is so
+		//stiff near a standstill that an explicit step would reverse the slip by many times what it removes.
+		const Real inverseEffectiveMass(0.135);
+		const Real normalLoad(1000.0);
+		const Real linearVelocity(0.2);
+		Real slipVelocity(0.01);
+
+		const Real explicitImpulse(tire.GetFrictionCoefficient(slipVelocity / TireSpecification::kMinimumSlipSpeed) * normalLoad * kTestFixedTimeStep);
+		ExpectedValue(explicitImpulse * inverseEffectiveMass >= 2.0 * slipVelocity, true, "Expected an explicit step to be unstable for this test.");
+
+		const Real firstImpulse(tire.ComputeContactImpulse(slipVelocity, linearVelocity, normalLoad, inverseEffectiveMass, kTestFixedTimeStep));
+		ExpectedValue(firstImpulse > 0.0 && firstImpulse < explicitImpulse, true, "Semi-implicit step should be weaker than the explicit step.");
+		ExpectedValue(firstImpulse * inverseEffectiveMass <= slipVelocity + kTestEpsilon, true, "Semi-implicit step should not reverse the slip.");
+
+		for (int timer(0); timer < 1000; timer += 10)
+		{
+			const Real previousSlipVelocity(slipVelocity);
+			slipVelocity -= inverseEffectiveMass * tire.ComputeContactImpulse(slipVelocity, linearVelocity, normalLoad, inverseEffectiveMass, kTestFixedTimeStep);
+			ExpectedValue(slipVelocity >= 0.0 && slipVelocity <= previousSlipVelocity, true, "Slip should shrink without changing direction.");
+		}
+
+		ExpectedValueWithin(slipVelocity, 0.0, kTestEpsilon, "Slip should settle at a standstill.");
+	}
+
+	{	//A wheel spinning slightly faster than a racecar rolling at walking pace.
+		Racecar::DoNothingController racecarController;
+		Racecar::RacecarBody carBody(92.0);
+		Racecar::Wheel wheel(8.0, 0.25);
+		wheel.SetTire(std::make_shared<const TireSpecification>(tire));
+
+		carBody.SetWheel(0, &wheel);
+		wheel.SetRacecarBody(&carBody);
+		wheel.SetOnGround(true, 0.7);
+		carBody.SetLinearVelocity(1.0);
+		wheel.SetLinearVelocity(1.0);
+		wheel.SetAngularVelocity(1.2 / wheel.GetRadius());
+
+		Real previousSlipVelocity(wheel.GetAngularVelocity() * wheel.GetRadius() - carBody.GetLinearVelocity());
+		for (int timer(0); timer < 1000; timer += 10)
+		{
+			wheel.ControllerChange(racecarController);
+			carBody.ControllerChange(racecarController);
+			wheel.Simulate(kTestFixedTimeStep);
+			carBody.Simulate(kTestFixedTimeStep);
+
+			const Real slipVelocity(wheel.GetAngularVelocity() * wheel.GetRadius() - carBody.GetLinearVelocity());
+			ExpectedValue(slipVelocity >= -kTestEpsilon && slipVelocity <= previousSlipVelocity + kTestEpsilon, true, "Wheel slip should shrink without changing direction.");
+			previousSlipVelocity = slipVelocity;
+		}
+
+		ExpectedValueWithin(previousSlipVelocity, 0.0, kTestEpsilon, "Wheel should roll with the racecar.");
+	}
+
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Racecar::UnitTests::SurfaceMapTest(void)
+{
+	const SurfaceCell tarmac(SurfaceCell::FromFrictionCoefficient(1.0, SurfaceType::Tarmac));
+	const SurfaceCell grass(SurfaceCell::FromFrictionCoefficient(0.3, SurfaceType::Grass));
+	const SurfaceCell gravel(SurfaceCell::FromFrictionCoefficient(0.55, SurfaceType::Gravel));
+	const SurfaceCell wall(SurfaceCell::FromFrictionCoefficient(Wheel::kInfiniteFriction, SurfaceType::Wall));
+	const SurfaceCell ice(SurfaceCell::FromFrictionCoefficient(0.0, SurfaceType::Tarmac));
+
+	//Three tiles wide and two high of 4x4 cells each, with the first cell at (-2, -1) meters.
+	std::shared_ptr<SurfaceMap> surfaceMap(std::make_shared<SurfaceMap>(3, 2, 2, 1.0, -2.0, -1.0, tarmac));
+	for (uint32_t cellX(0); cellX < surfaceMap->GetCellsWide(); ++cellX)
+	{
+		surfaceMap->SetCell(cellX, 5, grass);
+	}
+	surfaceMap->SetCell(11, 7, gravel);
+
+	SurfaceMap::TileCursor cursor;
+	ExpectedValue(surfaceMap->GetCellsWide(), 12u, "Surface map should be 12 cells wide.");
+	ExpectedValue(surfaceMap->GetCellsHigh(), 8u, "Surface map should be 8 cells high.");
+	ExpectedValue(static_cast<int>(surfaceMap->GetCell(0.5, 0.5, cursor).GetSurfaceType()), static_cast<int>(SurfaceType::Tarmac), "Expected tarmac near the origin.");
+	ExpectedValueWithin(surfaceMap->GetCell(7.5, 4.5, cursor).GetFrictionCoefficient(), 0.3, kTestEpsilon, "Expected grass along the sixth row.");
+	ExpectedValueWithin(surfaceMap->GetCell(-1.5, 4.5, cursor).GetFrictionCoefficient(), 0.3, kTestEpsilon, "Expected grass along the sixth row.");
+	ExpectedValueWithin(surfaceMap->GetCell(9.5, 6.5, cursor).GetFrictionCoefficient(), 0.55, kTestEpsilon, "Expected gravel in the far corner.");
+	ExpectedValueWithin(surfaceMap->GetCell(9.5, 5.5, cursor).GetFrictionCoefficient(), 1.0, kTestEpsilon, "Expected tarmac beside the gravel.");
+	ExpectedValueWithin(surfaceMap->GetCell(10.5, 0.0, cursor).GetFrictionCoefficient(), 1.0, kTestEpsilon, "Expected outside cell beyond the map.");
+	ExpectedValueWithin(surfaceMap->GetCell(0.0, -1.5, cursor).GetFrictionCoefficient(), 1.0, kTestEpsilon, "Expected outside cell beyond the map.");
+
+	surfaceMap->SetCell(0, 0, wall);
+	ExpectedValueWithin(surfaceMap->GetCell(-1.5, -0.5, cursor).GetFrictionCoefficient(), Wheel::kInfiniteFriction, kTestEpsilon, "Expected the wall to grip infinitely.");
+	surfaceMap->SetCell(1, 0, ice);
+	ExpectedValueWithin(surfaceMap->GetCell(-0.5, -0.5, cursor).GetFrictionCoefficient(), 0.0, kTestEpsilon, "Expected the ice to have no grip at all.");
+
+	//Saving and loading should give back every cell, and the loaded file can be viewed in place without a copy.
+	const std::string filePath("surface_map_test.rsm");
+	surfaceMap->SaveToFile(filePath);
+	std::unique_ptr<SurfaceMap> loadedMap(SurfaceMap::LoadFromFile(filePath));
+	std::remove(filePath.c_str());
+
+	const size_t fileSize(sizeof(SurfaceMap::SurfaceMapHeader) + 12 * 8 * sizeof(SurfaceCell));
+	std::vector<uint8_t> fileData(fileSize);
+	memcpy(fileData.data(), &loadedMap->GetHeader(), fileSize);
+	const SurfaceMap viewedMap(fileData.data(), fileData.size());
+	for (uint32_t cellY(0); cellY < 8; ++cellY)
+	{
+		for (uint32_t cellX(0); cellX < 12; ++cellX)
+		{
+			SurfaceMap::TileCursor mapCursor;
+			SurfaceMap::TileCursor viewCursor;
+			const Real positionX(cellX - 1.5);
+			const Real positionY(cellY - 0.5);
+			const SurfaceCell& expectedCell(surfaceMap->GetCell(positionX, positionY, cursor));
+			ExpectedValue(loadedMap->GetCell(positionX, positionY, mapCursor).mFriction, expectedCell.mFriction, "Loaded map lost a cell.");
+			ExpectedValue(viewedMap.GetCell(positionX, positionY, viewCursor).mFriction, expectedCell.mFriction, "Viewed map lost a cell.");
+		}
+	}
+
+	{	//Driving the racecar along the x axis from tarmac onto grass.
+		std::shared_ptr<SurfaceMap> trackMap(std::make_shared<SurfaceMap>(4, 1, 3, 0.5, 0.0, -2.0, tarmac));
+		for (uint32_t cellX(20); cellX < trackMap->GetCellsWide(); ++cellX)
+		{
+			for (uint32_t cellY(0); cellY < trackMap->GetCellsHigh(); ++cellY)
+			{
+				trackMap->SetCell(cellX, cellY, grass);
+			}
+		}
+
+		Racecar::DoNothingController racecarController;
+		Racecar::RacecarBody racecarBody(100.0);
+		Racecar::Wheel wheel(10.0, 0.25);
+		racecarBody.SetWheel(0, &wheel);
+		wheel.SetRacecarBody(&racecarBody);
+		wheel.SetOnGround(true, Wheel::kInfiniteFriction);
+		racecarBody.SetSurfaceMap(trackMap);
+		racecarBody.SetLinearVelocity(5.0);
+		wheel.SetAngularVelocity(5.0 / 0.25);
+
+		for (size_t step(0); step < 300; ++step)
+		{
+			const bool isOnGrass(racecarBody.GetDistanceTravelled() >= 10.0);
+			wheel.ControllerChange(racecarController);
+			wheel.Simulate(kTestFixedTimeStep);
+			racecarBody.ControllerChange(racecarController);
+			racecarBody.Simulate(kTestFixedTimeStep);
+			ExpectedValueWithin(wheel.GetGroundFrictionCoefficient(), (true == isOnGrass) ? 0.3 : 1.0, kTestEpsilon, "Wheel did not take the friction of the surface.");
+		}
+
+		ExpectedValue(static_cast<int>(racecarBody.GetWheelSurface(0)), static_cast<int>(SurfaceType::Grass), "Racecar should have driven onto the grass.");
+		ExpectedValue(wheel.IsOnGround(), true, "Surface map should not lift the wheel from the ground.");
+	}
+
+	{	//With the right side of the track grass, only the right wheels drive on it.
+		std::shared_ptr<SurfaceMap> trackMap(std::make_shared<SurfaceMap>(4, 1, 3, 0.5, 0.0, -2.0, tarmac));
+		for (uint32_t cellX(0); cellX < trackMap->GetCellsWide(); ++cellX)
+		{
+			for (uint32_t cellY(0); cellY < trackMap->GetCellsHigh() / 2; ++cellY)
+			{
+				trackMap->SetCell(cellX, cellY, grass);
+			}
+		}
+
+		Racecar::DoNothingController racecarController;
+		Racecar::RacecarBody racecarBody(100.0);
+		std::array<Racecar::Wheel, 4> wheels{ Wheel(10.0, 0.25), Wheel(10.0, 0.25), Wheel(10.0, 0.25), Wheel(10.0, 0.25) };
+		for (size_t wheelIndex(0); wheelIndex < wheels.size(); ++wheelIndex)
+		{
+			racecarBody.SetWheel(wheelIndex, &wheels[wheelIndex]);
+			wheels[wheelIndex].SetRacecarBody(&racecarBody);
+			wheels[wheelIndex].SetOnGround(true, Wheel::kInfiniteFriction);
+		}
+
+		racecarBody.SetSurfaceMap(trackMap);
+		racecarBody.SetTrackWidth(1.5);
+		racecarBody.SetDistanceTravelled(5.0);
+		racecarBody.ControllerChange(racecarController);
+		racecarBody.Simulate(kTestFixedTimeStep);
+
+		for (size_t wheelIndex(0); wheelIndex < wheels.size(); ++wheelIndex)
+		{
+			const bool isRightWheel(1 == wheelIndex % 2);
+			ExpectedValue(static_cast<int>(racecarBody.GetWheelSurface(wheelIndex)),
+				static_cast<int>((true == isRightWheel) ? SurfaceType::Grass : SurfaceType::Tarmac), "Only the right wheels should be on the grass.");
+			ExpectedValueWithin(wheels[wheelIndex].GetGroundFrictionCoefficient(), (true == isRightWheel) ? 0.3 : 1.0, kTestEpsilon,
+				"Wheel did not take the friction of the surface beneath it.");
+		}
+	}
+
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
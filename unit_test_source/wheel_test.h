@@ -17,6 +17,25 @@ namespace Racecar
 		bool WheelNegativeBrakingTest(void);
 		bool WheelAndAxleBrakingTest(void);
 		bool WheelClutchAndEngineBrakingTest(void);
+
+		///
+		/// @details Checks the tire lookup table follows the Magic Formula and the batch path matches it, then releases a
+		///   spinning wheel with a tire from a jack and checks the tire pulls the racecar up to the rolling speed.
+		///
+		bool TireModelTest(void);
+
+		///
+		/// @details Settles the slip of a tire at walking pace with a 10ms step, where an explicit step of the tire force
+		///   would overshoot, checking the slip shrinks every step without changing direction.
+		///
+		bool TireLowSpeedStabilityTest(void);
+
+		///
+		/// @details Finds cells across and beyond the tiles of a surface map, including ice without grip and a wall of
+		///   infinite grip, saves and loads it, views it in place and drives a racecar from tarmac onto grass, checking
+		///   the wheel takes the friction of the grass.
+		///
+		bool SurfaceMapTest(void);
 	};
 };
 